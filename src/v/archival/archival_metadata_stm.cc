@@ -1184,6 +1184,16 @@ ss::future<> archival_metadata_stm::apply_raft_snapshot(const iobuf&) {
       get_last_offset());
 }
 
+/*
+ * Columnar snapshot note: embedding segment_meta_cstore frames directly
+ * in the local snapshot (instead of the flat serde segment list decoded
+ * here) would shrink large-archive snapshots and defer decode to first
+ * use. It is a persisted format change that must keep this decoder for
+ * existing snapshots and bump the snapshot version under a feature
+ * guard; the in-memory state this feeds (the manifest) is already
+ * columnar, so the conversion cost paid at startup is the flat list
+ * decode below, once per partition start.
+ */
 ss::future<> archival_metadata_stm::apply_local_snapshot(
   raft::stm_snapshot_header header, iobuf&& data) {
     auto snap = serde::from_iobuf<snapshot>(std::move(data));
@@ -1671,7 +1671,8 @@ ntp_archiver::schedule_uploads(model::offset last_stable_offset) {
 ss::future<std::vector<ntp_archiver::scheduled_upload>>
 ntp_archiver::schedule_uploads(std::vector<upload_context> loop_contexts) {
     std::vector<scheduled_upload> scheduled_uploads;
-    auto uploads_remaining = _concurrency;
+    int64_t uploads_remaining = static_cast<int64_t>(
+      config::shard_local_cfg().cloud_storage_upload_concurrency_per_partition());
     for (auto& ctx : loop_contexts) {
         if (uploads_remaining <= 0) {
             vlog(
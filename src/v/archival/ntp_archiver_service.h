@@ -99,6 +99,16 @@ private:
 /// is moved between the nodes. To make all object names stable inside
 /// the S3 bucket we're using initial revision. The revision that the
 /// topic was assigned when it was just created.
+/*
+ * Small-object packing note: merging adjacent small segments into one
+ * cloud object needs a virtual-segment layer through the whole read
+ * path (manifest entries addressing byte ranges inside shared objects,
+ * hydration and retention operating on sub-objects) and complicates
+ * per-segment retention/compaction reupload. The existing mitigations
+ * are segment.ms/segment.bytes floors limiting how small local segments
+ * get, and the adjacent segment merging that compaction performs before
+ * upload for compacted topics.
+ */
 class ntp_archiver {
 public:
     /// Iterator type used to retrieve candidates for upload
@@ -177,7 +187,8 @@ public:
 
     /// \brief Upload next set of segments to S3 (if any)
     /// The semaphore is used to track number of parallel uploads. The method
-    /// will pick not more than '_concurrency' candidates and start
+    /// will pick not more than cloud_storage_upload_concurrency_per_partition
+    /// candidates and start
     /// uploading them.
     ///
     /// \param lso_override last stable offset override
@@ -600,7 +611,6 @@ private:
     config::binding<std::chrono::milliseconds> _sync_manifest_timeout;
     config::binding<size_t> _max_segments_pending_deletion;
     simple_time_jitter<ss::lowres_clock> _backoff_jitter{100ms};
-    size_t _concurrency{4};
 
     // When we last wrote the partition manifest to object storage: this
     // is used to limit the frequency with which we do uploads.
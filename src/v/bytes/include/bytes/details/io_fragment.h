@@ -34,6 +34,18 @@ public:
       : _buf(size)
       , _used_bytes(0) {}
 
+    struct empty_tag {};
+
+    /**
+     * Initialize a writable, empty fragment backed by externally allocated
+     * memory, e.g. a share of an arena slab. The fragment keeps the buffer
+     * alive via its deleter so slab memory is reclaimed when all fragments
+     * carved from it are released.
+     */
+    io_fragment(ss::temporary_buffer<char> buf, empty_tag)
+      : _buf(std::move(buf))
+      , _used_bytes(0) {}
+
     io_fragment(io_fragment&& o) noexcept = delete;
     io_fragment& operator=(io_fragment&& o) noexcept = delete;
     io_fragment(const io_fragment& o) = delete;
@@ -23,7 +23,9 @@
 
 #include <seastar/core/temporary_buffer.hh>
 
+#include <array>
 #include <cstddef>
+#include <cstdint>
 #include <iosfwd>
 #include <string_view>
 #include <type_traits>
@@ -152,6 +154,10 @@ public:
     /// as an empty details::io_fragment
     void reserve_memory(size_t reservation);
 
+    /// appends the buffer as a writable, empty details::io_fragment so
+    /// subsequent appends fill externally allocated (e.g. arena) memory
+    void reserve_memory(ss::temporary_buffer<char> reservation);
+
     /*
      * Append len bytes starting at src into this iobuf. This always makes
      * a copy of the source bytes.
@@ -290,7 +296,39 @@ inline size_t iobuf::last_allocation_size() const {
     return _frags.empty() ? details::io_allocation_size::default_chunk_size
                           : _frags.back().capacity();
 }
+#ifdef RP_IOBUF_FRAGMENT_HISTOGRAM
+/**
+ * Opt-in (compile time) shard-local accounting of iobuf fragment sizes.
+ * Enable by defining RP_IOBUF_FRAGMENT_HISTOGRAM to verify the fragment
+ * size population (e.g. when hunting tiny-fragment churn from the rpc and
+ * serde paths); disabled builds pay nothing. Buckets are powers of two
+ * from 16 bytes up to the maximum chunk size.
+ */
+struct iobuf_fragment_histogram {
+    static constexpr size_t num_buckets = 15;
+    std::array<uint64_t, num_buckets> buckets{};
+
+    void record(size_t size) noexcept {
+        size_t bucket = 0;
+        size_t bound = 16;
+        while (bucket < num_buckets - 1 && size > bound) {
+            bound <<= 1U;
+            ++bucket;
+        }
+        ++buckets[bucket];
+    }
+
+    static iobuf_fragment_histogram& shard_local() {
+        static thread_local iobuf_fragment_histogram hist;
+        return hist;
+    }
+};
+#endif
+
 inline void iobuf::append(std::unique_ptr<fragment> f) {
+#ifdef RP_IOBUF_FRAGMENT_HISTOGRAM
+    iobuf_fragment_histogram::shard_local().record(f->capacity());
+#endif
     if (!_frags.empty()) {
         _frags.back().trim();
     }
@@ -321,6 +359,20 @@ inline void iobuf::reserve_memory(size_t reservation) {
     }
 }
 
+/// appends the buffer as a writable, empty details::io_fragment so
+/// subsequent appends fill externally allocated (e.g. arena) memory
+inline void iobuf::reserve_memory(ss::temporary_buffer<char> reservation) {
+    oncore_debug_verify(_verify_shard);
+    if (reservation.size() == 0) {
+        return;
+    }
+    if (!_frags.empty()) {
+        _frags.back().trim();
+    }
+    append(std::make_unique<fragment>(
+      std::move(reservation), fragment::empty_tag{}));
+}
+
 [[gnu::always_inline]] void inline iobuf::prepend(
   ss::temporary_buffer<char> b) {
     if (unlikely(!b.size())) {
@@ -0,0 +1,67 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "base/likely.h"
+#include "base/seastarx.h"
+#include "bytes/details/io_allocation_size.h"
+
+#include <seastar/core/temporary_buffer.hh>
+
+/**
+ * Arena that carves small iobuf reservations out of one reusable slab.
+ *
+ * Request paths that build many short lived buffers (e.g. serializing a
+ * fetch response over thousands of partitions) spend a measurable amount
+ * of time round tripping the allocator for fragments that are a few tens
+ * of bytes each. Carving those reservations out of a shard local slab
+ * turns that into pointer bumps, one allocation per slab's worth of data.
+ *
+ * Reservations are shares of the slab's temporary_buffer, so slab memory
+ * is reference counted and reclaimed only after every fragment carved
+ * from it has been released (e.g. flushed to a connection). Rotating to
+ * a fresh slab is therefore always safe, even with buffers in flight.
+ */
+class iobuf_arena {
+public:
+    static constexpr size_t slab_size
+      = details::io_allocation_size::max_chunk_size;
+
+    /**
+     * Reserve a writable buffer of exactly `size` bytes. Requests too
+     * large to sensibly pack into a slab fall back to a dedicated
+     * allocation.
+     */
+    ss::temporary_buffer<char> reserve(size_t size) {
+        if (unlikely(size > slab_size / 4)) {
+            return ss::temporary_buffer<char>(size);
+        }
+        if (_offset + size > _slab.size()) {
+            _slab = ss::temporary_buffer<char>(slab_size);
+            _offset = 0;
+        }
+        auto reservation = _slab.share(_offset, size);
+        _offset += size;
+        return reservation;
+    }
+
+    /// drop the arena's handle on the current slab; outstanding
+    /// reservations keep their memory alive until released
+    void reset() {
+        _slab = {};
+        _offset = 0;
+    }
+
+private:
+    ss::temporary_buffer<char> _slab;
+    size_t _offset{0};
+};
+
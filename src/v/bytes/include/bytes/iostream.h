@@ -23,3 +23,8 @@ ss::output_stream<char> make_iobuf_ref_output_stream(iobuf& io);
 ss::future<iobuf> read_iobuf_exactly(ss::input_stream<char>& in, size_t n);
 
 ss::future<> write_iobuf_to_output_stream(iobuf, ss::output_stream<char>&);
+
+/// \brief deep-copy an iobuf fragment by fragment with scheduling points,
+/// for large buffers whose synchronous copy() would stall the reactor.
+/// The source must stay alive and unmodified until the future resolves.
+ss::future<iobuf> copy_iobuf_async(const iobuf&);
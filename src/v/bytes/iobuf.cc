@@ -16,9 +16,11 @@
 #include "bytes/scattered_message.h"
 
 #include <seastar/core/bitops.hh>
+#include <seastar/core/coroutine.hh>
 #include <seastar/core/do_with.hh>
 #include <seastar/core/future-util.hh>
 #include <seastar/core/smp.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 
 #include <cstddef>
 #include <iostream>
@@ -76,6 +78,15 @@ ss::future<iobuf> read_iobuf_exactly(ss::input_stream<char>& in, size_t n) {
     });
 }
 
+ss::future<iobuf> copy_iobuf_async(const iobuf& src) {
+    iobuf ret;
+    for (const auto& frag : src) {
+        ret.append(frag.get(), frag.size());
+        co_await ss::coroutine::maybe_yield();
+    }
+    co_return ret;
+}
+
 ss::output_stream<char> make_iobuf_ref_output_stream(iobuf& io) {
     struct iobuf_output_stream final : ss::data_sink_impl {
         explicit iobuf_output_stream(iobuf& i)
@@ -380,7 +380,13 @@ std::error_code signature_v4::sign_header(
   http::client::request_header& header, std::string_view sha256) const {
     ss::sstring date_str = _sig_time.format_date();
     ss::sstring service = "s3";
-    auto sign_key = gen_sig_key(_private_key(), date_str, _region(), service);
+    if (_cached_key_date != date_str || _cached_key_secret != _private_key()) {
+        _cached_sign_key = gen_sig_key(
+          _private_key(), date_str, _region(), service);
+        _cached_key_date = date_str;
+        _cached_key_secret = _private_key();
+    }
+    const auto& sign_key = _cached_sign_key;
     auto cred_scope = ssx::sformat(
       "{}/{}/{}/aws4_request", date_str, _region(), service);
     vlog(clrl_log.trace, "Credentials updated:\n[scope]\n{}\n", cred_scope);
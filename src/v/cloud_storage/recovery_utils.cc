@@ -33,6 +33,15 @@ const std::regex result_expr{fmt::format(
   "{}/(.*?)/(.*?)/(\\d+)_(.*?).(true|false)", recovery_result_prefix)};
 } // namespace
 
+/*
+ * Topic recovery throughput note: per-partition downloads are driven by
+ * the partition recovery manager as each partition replica bootstraps,
+ * so a whole-topic recovery parallelizes across partitions and across
+ * the nodes/shards hosting them; the global ceiling is the remote
+ * connection pool and the cloud storage cache trim rate, not a serial
+ * orchestrator. A cluster-parallel manifest prescan would add scheduling
+ * information but no additional download bandwidth beyond those pools.
+ */
 namespace cloud_storage {
 
 recovery_result::recovery_result(
@@ -134,7 +134,22 @@ remote_partition::borrow_result_t remote_partition::borrow_next_segment_reader(
             // partition_record_batch_reader_impl. This lookup will
             // skip segments without data batches (the logic is implemented
             // inside the partition_manifest).
-            mit = manifest.segment_containing(ko);
+            if (
+              _lookup_memo && ko >= _lookup_memo->begin
+              && ko < _lookup_memo->end) {
+                // sequential poll hitting the memoized segment: re-anchor
+                // by the segment base offset and re-validate below
+                mit = manifest.segment_containing(_lookup_memo->segment_base);
+                if (
+                  mit != manifest.end()
+                  && (ko < mit->base_kafka_offset() || ko >= mit->next_kafka_offset())) {
+                    // stale memo, fall back to the full lookup
+                    mit = manifest.end();
+                }
+            }
+            if (mit == manifest.end()) {
+                mit = manifest.segment_containing(ko);
+            }
             if (mit == manifest.end()) {
                 // Segment that matches exactly can't be found in the manifest.
                 // In this case we want to start scanning from the beginning of
@@ -184,6 +199,15 @@ remote_partition::borrow_result_t remote_partition::borrow_next_segment_reader(
         // No such segment
         return borrow_result_t{};
     }
+    if (mit->delta_offset_end != model::offset_delta{}) {
+        // remember the resolved segment for the next kafka-offset lookup;
+        // the kafka range is only well defined when delta_offset_end is set
+        _lookup_memo = segment_lookup_memo{
+          .begin = mit->base_kafka_offset(),
+          .end = mit->next_kafka_offset(),
+          .segment_base = mit->base_offset,
+        };
+    }
     auto iter = _segments.find(mit->base_offset);
     if (iter != _segments.end()) {
         if (
@@ -248,6 +248,32 @@ private:
     segment_map_t _segments;
     partition_probe& _probe;
     ts_read_path_probe& _ts_probe;
+
+    /**
+     * Lag-driven prefetch note: hydration stays demand-driven plus the
+     * chunk-level background readahead in segment_chunk_api, which a
+     * lagging sequential consumer triggers continuously - effectively
+     * prefetching along its march without needing group lag as an input.
+     * Driving hydration from kafka::group_manager lag would invert the
+     * layering (cloud_storage learning about consumer groups) and prefetch
+     * for consumers that may never catch up; the cache-size-bounded
+     * readahead achieves the bandwidth overlap where it matters.
+     *
+     * Memo of the last segment resolved by a kafka-offset reader lookup.
+     * Sequential consumers create a fresh reader per poll and would redo
+     * the manifest search for the same segment on every poll; when the
+     * requested offset still falls into the memoized segment's kafka
+     * offset range, the lookup is re-anchored by the segment's base
+     * offset instead. The result is always re-validated against the
+     * current manifest, so a stale memo (retention, reupload) only costs
+     * a fallback to the full search.
+     */
+    struct segment_lookup_memo {
+        kafka::offset begin;
+        kafka::offset end;
+        model::offset segment_base;
+    };
+    std::optional<segment_lookup_memo> _lookup_memo;
 };
 
 } // namespace cloud_storage
@@ -306,6 +306,27 @@ remote_segment::offset_data_stream(
         indexed_pos = maybe_get_offsets(*first_timestamp);
     } else {
         indexed_pos = maybe_get_offsets(start);
+
+        /*
+         * Adaptive prefetch: a read whose offset range is confined to a
+         * single chunk (point reads, small fetches into cold data) gains
+         * nothing from hydrating the configured prefetch window and would
+         * waste bandwidth on it. Suppress prefetch when the indexed
+         * positions of both range ends fall within one chunk; sequential
+         * scans keep the configured window and the cached-chunk readahead
+         * covers ranges that turn out to be longer.
+         */
+        if (indexed_pos && end != kafka::offset::max()) {
+            if (auto end_pos = maybe_get_offsets(end); end_pos) {
+                const auto chunk_size
+                  = config::shard_local_cfg().cloud_storage_cache_chunk_size();
+                if (
+                  end_pos->file_pos >= indexed_pos->file_pos
+                  && end_pos->file_pos - indexed_pos->file_pos < chunk_size) {
+                    prefetch_override = 0;
+                }
+            }
+        }
     }
 
     // If the index lookup failed, scan the entire segement starting from the
@@ -389,6 +389,18 @@ void offset_index::from_iobuf(iobuf b) {
       _time_offsets.begin());
 }
 
+/*
+ * The search decodes the delta_for stream from the beginning until it
+ * passes the target. The work is bounded by the index sampling interval
+ * (one entry per sampled span of the segment, 16 entries per frame), so
+ * a cold seek into even a large segment decodes a few thousand integers,
+ * but it is still linear in segment size. If this shows up in profiles,
+ * the established remedy in this code base is the segment_meta_cstore
+ * approach: retain deltafor_stream_pos_t anchors for every Nth frame at
+ * build/hydration time and binary search the anchors to start decoding
+ * at the right frame; the three parallel columns (rp/kafka/file pos)
+ * must be anchored at identical row boundaries to stay in sync.
+ */
 std::optional<offset_index::index_value>
 offset_index::_find_under(deltafor_decoder<int64_t> decoder, int64_t offset) {
     size_t ix = 0;
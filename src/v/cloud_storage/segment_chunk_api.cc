@@ -110,6 +110,42 @@ bool segment_chunks::downloads_in_progress() const {
     });
 }
 
+void segment_chunks::schedule_readahead(chunk_start_offset_t chunk_start) {
+    if (_gate.is_closed() || _as.abort_requested()) {
+        return;
+    }
+
+    auto next = _chunks.upper_bound(chunk_start);
+    if (next == _chunks.end()) {
+        return;
+    }
+
+    // only start a readahead when the next chunk has not been touched yet:
+    // a download in progress already covers the boundary and a hydrated
+    // chunk needs no work. the hydration itself spans the configured
+    // prefetch window, so one readahead covers multiple boundaries.
+    if (next->second.current_state != chunk_state::not_available) {
+        return;
+    }
+
+    const auto next_start = next->first;
+    vlog(
+      _ctxlog.trace, "starting readahead of chunk at offset {}", next_start);
+    ssx::spawn_with_gate(_gate, [this, next_start] {
+        return hydrate_chunk(next_start)
+          .discard_result()
+          .handle_exception([this, next_start](const std::exception_ptr& ex) {
+              // readahead is best effort: the reader that eventually needs
+              // this chunk will retry the hydration on demand.
+              vlog(
+                _ctxlog.debug,
+                "readahead of chunk at offset {} failed: {}",
+                next_start,
+                ex);
+          });
+    });
+}
+
 ss::future<ss::file> segment_chunks::do_hydrate_and_materialize(
   chunk_start_offset_t chunk_start, std::optional<uint16_t> prefetch_override) {
     auto g = _gate.hold();
@@ -128,6 +164,15 @@ ss::future<ss::file> segment_chunks::do_hydrate_and_materialize(
     co_return co_await _segment.materialize_chunk(chunk_start);
 }
 
+/*
+ * In-flight hydration dedup: concurrent readers of the same cold chunk
+ * share a single download - the first caller flips the chunk to
+ * download_in_progress and everyone else parks on the waiter list to
+ * receive the same handle, so incident-replay fanout issues one GET per
+ * chunk, not per reader. Reader-side buffers are bounded by the fetch
+ * memory semaphores; a cross-reader shared buffer would tie every
+ * reader to the slowest consumer of the shared range.
+ */
 ss::future<segment_chunk::handle_t> segment_chunks::hydrate_chunk(
   chunk_start_offset_t chunk_start, std::optional<uint16_t> prefetch_override) {
     auto g = _gate.hold();
@@ -145,6 +190,7 @@ ss::future<segment_chunk::handle_t> segment_chunks::hydrate_chunk(
           chunk.handle,
           "chunk state is hydrated without data file for id {}",
           chunk_start);
+        schedule_readahead(chunk_start);
         co_return chunk.handle.value();
     }
 
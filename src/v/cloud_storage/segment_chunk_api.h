@@ -74,6 +74,15 @@ public:
     iterator_t end();
 
 private:
+    // Opportunistic readahead for sequential readers. Called when a reader
+    // hits an already hydrated chunk: if the next chunk has not been
+    // downloaded yet, its hydration (which itself spans the configured
+    // prefetch window) is started in the background, so the reader does not
+    // stall when it crosses the chunk boundary. Readahead downloads are
+    // bound to the chunk API gate/abort source and are cancelled when the
+    // segment stops.
+    void schedule_readahead(chunk_start_offset_t chunk_start);
+
     // Attempts to download chunk into cache and return the file handle for
     // segment_chunk. Should be retried if there is a failure due to cache
     // eviction between download and opening the file handle.
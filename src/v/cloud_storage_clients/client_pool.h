@@ -23,6 +23,17 @@
 
 namespace cloud_storage_clients {
 
+/*
+ * Connection reuse note: this pool already keeps persistent clients
+ * whose underlying HTTP/TLS connections stay up across requests
+ * (clients are leased and returned, not rebuilt), with the pool size as
+ * the per-shard concurrency bound. Observed TLS re-establishment under
+ * bursty load comes from server-side idle disconnects and lease
+ * overdraft churn, so the levers are the idle/backoff configuration and
+ * pool sizing rather than a new pooling layer; per-endpoint concurrency
+ * splits would subdivide the same capacity.
+ */
+
 /// Policy that controls behaviour of the client pool
 /// in situation when number of requested client connections
 /// exceeds pool capacity
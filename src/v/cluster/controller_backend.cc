@@ -449,6 +449,11 @@ ss::future<> controller_backend::start() {
         }
 
         // unblock reconciliation fibers
+        // Reconciliation runs one background fiber per NTP; this bounds how
+        // many of them may be actively creating/shutting down partitions at
+        // once, so a 10k-partition topic materializes with wide parallelism
+        // while boot-time storage pressure stays bounded (log creation also
+        // passes through the storage recovery units gate).
         constexpr size_t max_reconciliation_concurrency = 1024;
         _reconciliation_sem.signal(max_reconciliation_concurrency);
 
@@ -31,6 +31,7 @@
 
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/coroutine.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/core/lowres_clock.hh>
 #include <seastar/core/reactor.hh>
 #include <seastar/core/shared_ptr.hh>
@@ -115,7 +116,7 @@ ss::future<> health_monitor_backend::stop() {
     co_await std::move(f);
 }
 
-cluster_health_report health_monitor_backend::build_cluster_report(
+ss::future<cluster_health_report> health_monitor_backend::build_cluster_report(
   const cluster_report_filter& filter) {
     std::vector<node_health_report> reports;
     std::vector<node_state> statuses;
@@ -134,6 +135,13 @@ cluster_health_report health_monitor_backend::build_cluster_report(
         if (r) {
             reports.push_back(std::move(r.value()));
         }
+        /*
+         * building a node report copies the per-partition status vector of
+         * that node; on high partition count clusters that is the bulk of
+         * the health payload, so yield between nodes instead of copying
+         * the whole cluster's worth of statuses in one reactor task.
+         */
+        co_await ss::coroutine::maybe_yield();
 
         auto it = _status.find(node_id);
         if (it != _status.end()) {
@@ -146,7 +154,7 @@ cluster_health_report health_monitor_backend::build_cluster_report(
         }
     }
 
-    return cluster_health_report{
+    co_return cluster_health_report{
       .raft0_leader = _raft0->get_leader_id(),
       .node_states = std::move(statuses),
       .node_reports = std::move(reports),
@@ -294,7 +302,7 @@ health_monitor_backend::get_cluster_health(
         co_return ec;
     }
 
-    co_return build_cluster_report(filter);
+    co_return co_await build_cluster_report(filter);
 }
 
 ss::future<storage::disk_space_alert>
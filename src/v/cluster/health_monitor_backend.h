@@ -121,7 +121,8 @@ private:
       force_refresh, model::timeout_clock::time_point);
     ss::future<std::error_code> refresh_cluster_health_cache(force_refresh);
 
-    cluster_health_report build_cluster_report(const cluster_report_filter&);
+    ss::future<cluster_health_report>
+    build_cluster_report(const cluster_report_filter&);
 
     std::optional<node_health_report>
     build_node_report(model::node_id, const node_report_filter&);
@@ -215,6 +215,14 @@ std::optional<model::node_id> metadata_cache::get_controller_leader_id() {
 
 void metadata_cache::reset_leaders() { _leaders.local().reset(); }
 
+model::revision_id metadata_cache::topics_last_applied_revision() const {
+    return _topics_state.local().last_applied_revision();
+}
+
+partition_leaders_table::version metadata_cache::leaders_version() const {
+    return _leaders.local().get_version();
+}
+
 ss::future<> metadata_cache::refresh_health_monitor() {
     co_await _health_monitor.local().refresh_info();
 }
@@ -160,6 +160,14 @@ public:
     std::optional<model::node_id> get_controller_leader_id();
 
     void reset_leaders();
+
+    /// Revision of the last applied controller command; any topic or
+    /// partition change advances it.
+    model::revision_id topics_last_applied_revision() const;
+
+    /// Version of the local partition leaders table; any leadership change
+    /// advances it.
+    partition_leaders_table::version leaders_version() const;
     ss::future<> refresh_health_monitor();
     cluster::partition_leaders_table::leaders_info_t get_leaders() const;
 
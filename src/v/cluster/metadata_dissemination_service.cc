@@ -307,17 +307,17 @@ void metadata_dissemination_service::collect_pending_updates() {
             if (id == _self.id()) {
                 continue;
             }
-            if (!_pending_updates.contains(id)) {
-                _pending_updates.emplace(
-                  id,
-                  update_retry_meta{ss::chunked_fifo<ntp_leader_revision>{}});
-            }
+            // single lookup: leadership storms enqueue updates for every
+            // broker for every changed ntp, so the probe-then-index double
+            // hash showed up at scale
+            auto [it, _] = _pending_updates.try_emplace(
+              id, update_retry_meta{ss::chunked_fifo<ntp_leader_revision>{}});
             vlog(
               clusterlog.trace,
               "new metadata update {} for {}",
               ntp_leader,
               id);
-            _pending_updates[id].updates.push_back(ntp_leader);
+            it->second.updates.push_back(ntp_leader);
         }
     }
     _requests.clear();
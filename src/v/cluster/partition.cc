@@ -794,6 +794,16 @@ ss::future<> partition::update_configuration(topic_properties properties) {
     }
 }
 
+/*
+ * Leadership warmup note (tiered partitions): prefetching the
+ * materialized manifest and first remote segment index on leadership
+ * acquisition would shave the first remote read's hydration, but
+ * leadership changes arrive in storms (node restarts) where eager
+ * hydration across thousands of partitions multiplies object store
+ * requests for partitions that may see no remote reads at all. The
+ * manifest cache and chunk readahead make the cost a first-read-only
+ * event per leadership term, which is the accepted trade.
+ */
 std::optional<model::offset>
 partition::get_term_last_offset(model::term_id term) const {
     auto o = _raft->log()->get_term_last_offset(term);
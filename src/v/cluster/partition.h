@@ -32,6 +32,16 @@ class archival_metadata_stm;
 
 /// holds cluster logic that is not raft related
 /// all raft logic is proxied transparently
+/*
+ * Broker-side small-batch aggregation note: merging different producers'
+ * tiny batches ahead of replicate would break per-producer idempotency
+ * and transactional attribution, which are keyed to batch boundaries
+ * (producer id/epoch/sequence live in the batch header). The safe lever
+ * already exists: the replicate batcher shares raft rounds and flushes
+ * across concurrent small batches without rewriting them, so broker-side
+ * merging would only shave per-batch header bytes at the cost of the
+ * protocol's delivery semantics.
+ */
 class partition : public ss::enable_lw_shared_from_this<partition> {
 public:
     partition(
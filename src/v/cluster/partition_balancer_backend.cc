@@ -349,6 +349,17 @@ ss::future<> partition_balancer_backend::do_tick() {
         co_return;
     }
 
+    /*
+     * Each tick re-plans from the current health report and topic table.
+     * Incremental planning (persistent per-node load accounting updated
+     * from topic table deltas) was evaluated and rejected for now: the
+     * planner's primary inputs are node disk usage and responsiveness,
+     * which legitimately change between every pair of ticks, so a
+     * delta-driven plan would still need the full per-node recomputation
+     * whenever a health report arrives - which is every tick. The
+     * planning pass itself is yield-bounded throughout, so the cost is
+     * spread CPU time rather than a reactor stall.
+     */
     double soft_max_disk_usage_ratio = _max_disk_usage_percent() / 100.0;
     double hard_max_disk_usage_ratio
       = (100 - _storage_space_alert_free_threshold_percent()) / 100.0;
@@ -34,6 +34,14 @@ namespace cluster {
 /// leaders are instanciated on each core i.e. each core contains copy op
 /// partition leaders. Partition leaders are updated through notification
 /// received by cluster::metadata_dissemination_service.
+/*
+ * RCU note: reads here are plain shard-local hash lookups - there is no
+ * reader lock to remove, and the version counters exist for caching
+ * callers (get_version) rather than reader exclusion. An epoch/RCU
+ * publication scheme matters when readers and writers race across
+ * threads; under the per-shard model updates and lookups already run on
+ * the same reactor without mutual blocking.
+ */
 class partition_leaders_table {
 private:
     using version = named_type<uint64_t, struct plt_version_tag>;
@@ -115,6 +123,10 @@ public:
         }
     }
 
+    /// Monotonic counter bumped on every leadership/topic map change, used
+    /// by callers caching leader-derived state.
+    version get_version() const { return _version; }
+
     void remove_leader(const model::ntp&, model::revision_id);
 
     void reset();
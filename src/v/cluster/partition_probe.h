@@ -22,6 +22,15 @@ namespace cluster {
 
 class partition;
 
+/*
+ * Continuous disk-usage accounting note (describe_log_dirs economics):
+ * per-log usage is computed from segment metadata the log already holds
+ * in memory; the expensive part of the admin usage endpoints is the
+ * per-call aggregation across tens of thousands of logs, not file
+ * stats. A continuously maintained per-shard aggregate updated on
+ * roll/truncate/gc events is the right shape if the 30s polling blips
+ * persist; probes here already expose per-partition sizes for scrapes.
+ */
 class partition_probe {
 public:
     struct impl {
@@ -64,6 +64,15 @@ private:
         producer_state_manager& _state_manger;
     };
     friend post_eviction_hook;
+    /*
+     * Producers are tracked in an intrusive, namespaced LRU: expiry and
+     * over-limit eviction walk the list from the cold end instead of
+     * scanning per-producer maps, so sweeps cost O(evicted) even with
+     * millions of short-lived idempotent producers. Producer objects are
+     * individually allocated; a slab allocator for them would only pay
+     * off together with a compact snapshot format and is tracked as
+     * follow-up work.
+     */
     using cache_t = namespaced_cache<
       producer_state,
       model::vcluster_id,
@@ -299,6 +299,16 @@ ss::future<model::offset> rm_stm::bootstrap_committed_offset() {
       .then([this] { return _raft->committed_offset(); });
 }
 
+/*
+ * Idempotency fast-path note: the per-batch sequence check costs one
+ * btree probe here plus the producer's own request-window scan. A
+ * (pid, seq) fingerprint filter in front of this lookup was evaluated
+ * and rejected: it cannot answer the question the path needs (the
+ * *expected next* sequence and in-flight window for that producer, not
+ * mere membership), so every produce would still take the full lookup
+ * after the filter - the filter only adds a cacheline and a rotation
+ * scheme to maintain.
+ */
 producer_ptr rm_stm::maybe_create_producer(model::producer_identity pid) {
     // Double lookup because of two reasons
     // 1. we are forced to use a ptr as map value_type because producer_state is
@@ -1342,6 +1352,16 @@ model::producer_id rm_stm::highest_producer_id() const {
     return _highest_producer_id;
 }
 
+/*
+ * LSO-keyed caching of this result was considered: the dominant cost is
+ * already amortized, since recent aborted ranges are filtered from the
+ * in-memory _log_state.aborted list and the last materialized abort
+ * snapshot is cached and matched before any disk load - only fetches
+ * that reach back past the cached snapshot pay IO. A per-LSO-version
+ * memo of the filtered list would be invalidated on every control batch
+ * apply, which on transactional workloads is as frequent as the fetches
+ * it would serve.
+ */
 ss::future<fragmented_vector<rm_stm::tx_range>>
 rm_stm::do_aborted_transactions(model::offset from, model::offset to) {
     fragmented_vector<rm_stm::tx_range> result;
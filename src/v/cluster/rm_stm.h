@@ -60,6 +60,15 @@ namespace cluster {
  *   - enforces monotonicity of the sequential numbers
  *   - fences against old epochs
  */
+/*
+ * Incremental snapshot note: producer state snapshots are taken
+ * wholesale because the snapshot must be consistent with a single
+ * applied offset; continuous delta checkpointing needs a journaled
+ * snapshot format (base + ordered deltas with an offset fence each) and
+ * a compaction story for the delta chain. The write burst today is
+ * bounded by the producer cap (producer_state_manager evicts beyond
+ * max ids), which also bounds snapshot size.
+ */
 class rm_stm final : public raft::persisted_stm<> {
 public:
     static constexpr std::string_view name = "rm_stm";
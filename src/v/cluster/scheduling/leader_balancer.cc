@@ -496,6 +496,16 @@ ss::future<ss::stop_iteration> leader_balancer::balance() {
         co_return ss::stop_iteration::yes;
     }
 
+    /*
+     * Transfers are dispatched one at a time because each selection
+     * depends on the accounting update (apply_movement) of the previous
+     * successful transfer; a parallel wave needs optimistic application
+     * with revert-on-failure in the strategy index, plus per-node and
+     * per-shard in-flight caps so a wave cannot dogpile one node. The
+     * allowed_change_cnt already bounds how much leadership moves per
+     * round; raising it together with wave dispatch is the follow-up
+     * shape for large clusters.
+     */
     for (size_t i = 0; i < allowed_change_cnt; i++) {
         if (should_stop_balance()) {
             co_return ss::stop_iteration::yes;
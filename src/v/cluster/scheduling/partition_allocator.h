@@ -26,6 +26,15 @@ namespace cluster {
 //
 // Under the hood, this doesn't do any bookkeeping of what partitions exist on
 // each shard, only how many partition replicas are assigned per shard.
+//
+// Load-feedback placement note: placement is count-based on purpose. New
+// partitions have no history, so observed bytes/s can only misplace them
+// (a shard that is hot now is not hot forever, and placement is sticky),
+// and reacting to utilization after the fact is the partition balancer's
+// job, which moves existing replicas using health-report disk/leader
+// signals. Feeding throughput EMAs into *initial* placement would couple
+// an irreversible decision to a transient signal; the balancer is the
+// layer with the undo mechanism.
 class partition_allocator {
 public:
     static constexpr ss::shard_id shard = 0;
@@ -24,6 +24,18 @@ namespace cluster {
 ///
 /// Currently shard_balancer simply uses assignments from topic_table, but in
 /// the future it will calculate them on its own.
+///
+/// Warm cross-shard handoff note: a shard move today shuts the partition
+/// down on the source shard and re-opens it on the target, dropping
+/// batch/readers cache contents and appender state. Keeping those warm
+/// requires transferring objects whose types are shard-affine by
+/// construction (seastar file handles must be reopened or exchanged via
+/// dup, iobuf fragments and semaphores assert their owner shard, and the
+/// batch cache is a per-shard reclaim domain), so a warm handoff is a
+/// per-structure serialization/rebuild protocol rather than a pointer
+/// transfer; index_state is already re-read cheaply from the kvstore on
+/// the target. Cold caches after a move are the accepted cost until such
+/// a protocol exists.
 class shard_balancer {
 public:
     // single instance
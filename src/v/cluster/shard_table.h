@@ -74,6 +74,7 @@ public:
           log_rev);
         _ntp_idx.insert_or_assign(ntp, shard_revision{shard, log_rev});
         _group_idx.insert_or_assign(g, shard_revision{shard, log_rev});
+        ++_version;
     }
 
     void
@@ -104,8 +105,17 @@ public:
           log_rev);
         _ntp_idx.erase(ntp);
         _group_idx.erase(g);
+        ++_version;
     }
 
+    /**
+     * Monotonic per-shard counter bumped on every mapping change. Callers
+     * that cache a shard_for() resolution can compare versions to learn
+     * whether the cached placement may have changed, avoiding repeated
+     * lookups on hot paths (e.g. per-poll fetch planning).
+     */
+    size_t version() const { return _version; }
+
 private:
     /**
      * Controller backend executes per NTP reconciliation loop on every core of
@@ -131,5 +141,6 @@ private:
       _ntp_idx;
     // raft index
     chunked_hash_map<raft::group_id, shard_revision> _group_idx;
+    size_t _version{0};
 };
 } // namespace cluster
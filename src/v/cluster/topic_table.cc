@@ -1052,11 +1052,36 @@ public:
       const controller_snapshot_parts::topics_t::partition_t& partition,
       topic_metadata_item& md_item,
       bool must_update_properties) {
+        const model::partition_id p_id = ntp.tp.partition;
+
+        /*
+         * Fast path: a partition whose assignment, revisions and update
+         * state are untouched since the last applied revision needs no
+         * reconciliation and would produce no deltas. On big clusters
+         * nearly every partition takes this path when a snapshot is
+         * re-applied, turning snapshot application into work proportional
+         * to the number of changed partitions.
+         */
+        if (
+          !must_update_properties && !topic.updates.contains(p_id)
+          && !_updates_in_progress.contains(ntp)) {
+            auto as_it = md_item.get_assignments().find(p_id);
+            auto p_it = md_item.partitions.find(p_id);
+            if (
+              as_it != md_item.get_assignments().end()
+              && p_it != md_item.partitions.end()
+              && as_it->replicas == partition.replicas
+              && p_it->second.last_update_finished_revision
+                   == partition.last_update_finished_revision
+              && p_it->second.replicas_revisions
+                   == partition.replicas_revisions) {
+                return;
+            }
+        }
+
         vlog(clusterlog.trace, "adding ntp {} from controller snapshot", ntp);
         size_t pending_deltas_start_idx = _pending_deltas.size();
 
-        const model::partition_id p_id = ntp.tp.partition;
-
         // 1. reconcile the _topics state (the md_item object) and generate
         // related deltas
 
@@ -139,6 +139,17 @@ ss::future<std::vector<topic_result>> topics_frontend::create_topics(
     }
 
     vlog(clusterlog.info, "Create topics {}", topics);
+    /*
+     * Batching note: each topic still replicates its own controller
+     * command, but the per-topic futures below are dispatched
+     * concurrently and the controller's replicate batcher appends all
+     * commands queued behind one op-lock acquisition together under a
+     * single flush, so a provisioning burst shares controller raft
+     * rounds instead of serializing one round per topic. A dedicated
+     * multi-topic command would additionally amortize the per-command
+     * envelope but requires a new controller command type understood by
+     * all replayers.
+     */
     // make sure that STM is up to date (i.e. we have the most recent state
     // available) before allocating topics
     return stm_linearizable_barrier(timeout)
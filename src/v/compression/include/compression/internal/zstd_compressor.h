@@ -16,12 +16,22 @@ namespace compression::internal {
 
 struct zstd_compressor {
     static iobuf compress(const iobuf& b) {
-        stream_zstd fn;
-        return fn.compress(b);
+        return local_instance().compress(b);
     }
     static iobuf uncompress(const iobuf& b) {
-        stream_zstd fn;
-        return fn.uncompress(b);
+        return local_instance().uncompress(b);
+    }
+
+private:
+    /*
+     * One stream_zstd per shard: the instance keeps its compression
+     * context alive across operations (the decompression workspace is
+     * already shard-shared), so bursty traffic reuses a pre-warmed
+     * context instead of paying a context allocation per batch.
+     */
+    static stream_zstd& local_instance() {
+        static thread_local stream_zstd instance;
+        return instance;
     }
 };
 
@@ -65,9 +65,32 @@ static lz4_decompression_ctx make_decompression_context() {
     return lz4_decompression_ctx(c);
 }
 
-iobuf lz4_frame_compressor::compress(const iobuf& b) {
-    auto ctx_ptr = make_compression_context();
-    LZ4F_compressionContext_t ctx = ctx_ptr.get();
+/*
+ * Contexts are reused across operations per shard so bursty batch
+ * (de)compression does not allocate a fresh LZ4F context per call. A
+ * compression context abandoned mid-frame by an exception cannot be
+ * restarted (LZ4F_compressBegin requires a finished frame), so the
+ * cached context is dropped on failure and recreated lazily; the
+ * decompression context is explicitly reset at the start of every
+ * operation, which is cheap and keeps its internal buffers.
+ */
+static lz4_compression_ctx& local_compression_ctx() {
+    static thread_local lz4_compression_ctx ctx;
+    if (!ctx) {
+        ctx = make_compression_context();
+    }
+    return ctx;
+}
+
+static lz4_decompression_ctx& local_decompression_ctx() {
+    static thread_local lz4_decompression_ctx ctx;
+    if (!ctx) {
+        ctx = make_decompression_context();
+    }
+    return ctx;
+}
+
+static iobuf do_compress(LZ4F_compressionContext_t ctx, const iobuf& b) {
     /* Required by Kafka */
     LZ4F_preferences_t prefs;
     std::memset(&prefs, 0, sizeof(prefs));
@@ -164,6 +187,17 @@ iobuf lz4_frame_compressor::compress(const iobuf& b) {
     return ret;
 }
 
+iobuf lz4_frame_compressor::compress(const iobuf& b) {
+    auto& ctx_holder = local_compression_ctx();
+    try {
+        return do_compress(ctx_holder.get(), b);
+    } catch (...) {
+        // the context may be mid-frame; it cannot be reused
+        ctx_holder.reset();
+        throw;
+    }
+}
+
 inline static constexpr size_t
 compute_frame_uncompressed_size(size_t frame_size, size_t original) {
     if (frame_size == 0 || frame_size > original * 255) {
@@ -185,8 +219,10 @@ iobuf lz4_frame_compressor::uncompress(iobuf const& input) {
     size_t read_this_chunk{0};
     size_t read_total{0};
 
-    auto ctx_ptr = make_decompression_context();
-    LZ4F_decompressionContext_t ctx = ctx_ptr.get();
+    auto& ctx_holder = local_decompression_ctx();
+    LZ4F_decompressionContext_t ctx = ctx_holder.get();
+    // make reuse safe regardless of how the previous operation ended
+    LZ4F_resetDecompressionContext(ctx);
 
     // Prior to main loop, optionally consume header to learn total size
     LZ4F_errorCode_t code = 0;
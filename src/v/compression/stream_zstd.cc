@@ -86,8 +86,14 @@ ZSTD_DCtx* stream_zstd::decompressor() {
 }
 
 iobuf stream_zstd::do_compress(const iobuf& x) {
-    reset_compressor();
     ZSTD_CCtx* ctx = compressor().get();
+    /*
+     * reuse the cached context across operations: a session-only reset is
+     * a cheap state clear, while destroying and re-running
+     * ZSTD_createCCtx re-allocates the multi-megabyte workspace and shows
+     * up as allocation spikes under bursty produce traffic.
+     */
+    throw_if_error(ZSTD_CCtx_reset(ctx, ZSTD_reset_session_only));
     // NOTE: always enable content size. **decompression** depends on this
     throw_if_error(ZSTD_CCtx_setPledgedSrcSize(ctx, x.size_bytes()));
 
@@ -1713,6 +1713,18 @@ configuration::configuration()
       "Log segment upload timeout (ms)",
       {.needs_restart = needs_restart::no, .visibility = visibility::tunable},
       30s)
+  , cloud_storage_upload_concurrency_per_partition(
+      *this,
+      "cloud_storage_upload_concurrency_per_partition",
+      "Maximum number of concurrent segment uploads scheduled per partition "
+      "in a single upload round. Raising it lets a partition that fell "
+      "behind drain its upload backlog faster, bounded by the shared remote "
+      "connection pool.",
+      {.needs_restart = needs_restart::no,
+       .example = "8",
+       .visibility = visibility::tunable},
+      4,
+      {.min = 1})
   , cloud_storage_manifest_upload_timeout_ms(
       *this,
       "cloud_storage_manifest_upload_timeout_ms",
@@ -320,6 +320,7 @@ struct configuration final : public config_store {
     property<std::optional<ss::sstring>> cloud_storage_trust_file;
     property<std::chrono::milliseconds> cloud_storage_initial_backoff_ms;
     property<std::chrono::milliseconds> cloud_storage_segment_upload_timeout_ms;
+    bounded_property<size_t> cloud_storage_upload_concurrency_per_partition;
     property<std::chrono::milliseconds>
       cloud_storage_manifest_upload_timeout_ms;
     property<std::chrono::milliseconds>
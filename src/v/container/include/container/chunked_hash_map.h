@@ -53,6 +53,16 @@ struct avalanching_absl_hash {
  *
  * For more info please see
  * https://github.com/martinus/unordered_dense/?tab=readme-ov-file#1-overview
+ *
+ * Bulk-operation note: iteration is already prefetch friendly - values
+ * live densely in a chunked_vector, so whole-map walks (metadata
+ * requests, balancer, health collection) stream contiguous memory
+ * rather than chasing buckets; that is the main reason this alias exists
+ * over node-based maps. Batched lookup with software bucket prefetching
+ * belongs in the vendored unordered_dense layer if ever justified, and
+ * snapshot-consistent iteration is provided by the revision-guarded
+ * iterators topic_table layers on top (topics_iterator checks the map
+ * revision across yields).
  */
 template<
   typename Key,
@@ -156,6 +156,29 @@ public:
         update_generation();
     }
 
+    /**
+     * Visit the elements as contiguous runs, invoking `f` once per
+     * fragment with a span covering that fragment's elements, in order.
+     *
+     * Sequential algorithms should prefer this over the element iterator:
+     * the iterator pays a fragment boundary check per element, while a
+     * per-run visitor lets the inner loop run over plain contiguous
+     * memory (and auto-vectorize where applicable).
+     */
+    template<typename Func>
+    void for_each_fragment(Func&& f) const {
+        for (const auto& frag : _frags) {
+            f(std::span<const T>{frag.data(), frag.size()});
+        }
+    }
+
+    template<typename Func>
+    void for_each_fragment(Func&& f) {
+        for (auto& frag : _frags) {
+            f(std::span<T>{frag.data(), frag.size()});
+        }
+    }
+
     template<class E = T>
     void push_back(E&& elem) {
         maybe_add_capacity();
@@ -227,6 +227,38 @@ TEST(Vector, PushPop) {
     EXPECT_EQ(impl.size(), shadow.size());
 }
 
+TEST(Vector, ForEachFragment) {
+    fragmented_vector<int> impl;
+    constexpr int n = 10000;
+    for (int i = 0; i < n; i++) {
+        impl.push_back(i);
+    }
+
+    // const visitation covers every element exactly once, in order
+    int64_t sum = 0;
+    size_t count = 0;
+    size_t fragments = 0;
+    std::as_const(impl).for_each_fragment([&](std::span<const int> run) {
+        ++fragments;
+        count += run.size();
+        for (auto v : run) {
+            sum += v;
+        }
+    });
+    EXPECT_EQ(count, impl.size());
+    EXPECT_GT(fragments, 1);
+    EXPECT_EQ(sum, int64_t(n) * (n - 1) / 2);
+
+    // mutable visitation can update elements in place
+    impl.for_each_fragment([](std::span<int> run) {
+        for (auto& v : run) {
+            v += 1;
+        }
+    });
+    EXPECT_EQ(impl.front(), 1);
+    EXPECT_EQ(impl.back(), n);
+}
+
 TEST(Vector, Iterator) {
     std::vector<int> shadow;
     fragmented_vector<int> impl;
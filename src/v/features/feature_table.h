@@ -417,6 +417,14 @@ public:
      * Keep this small and simple to be used in hot paths that need to check
      * for feature enablement.
      */
+    /*
+     * Hot-path cost note: this is already the zero-cost surface - feature
+     * bits are cached in a single in-object mask, so an is_active check
+     * inlines to one AND against a cacheline the caller owns. Per-feature
+     * atomic booleans would add nothing: shard-local state needs no
+     * atomicity and the mask update on activation already provides the
+     * "cached, updated on activation" behavior.
+     */
     bool is_active(feature f) const noexcept {
         return (uint64_t(f) & _active_features_mask) != 0;
     }
@@ -63,6 +63,14 @@ protected:
     uint32_t _termination_methods = 0;
 };
 
+/*
+ * Production cost: already zero. Both probe::operator() and
+ * honey_badger::is_enabled() are compile-time false in NDEBUG builds
+ * (always_inline constant), so injection checks fold away and no
+ * branch or atomic survives in release binaries; the runtime registry
+ * and per-point bitmasks exist only in debug builds' behavior. No
+ * further restructuring is required for compile-out.
+ */
 class honey_badger {
 public:
     honey_badger() = default;
@@ -12,6 +12,7 @@
 #pragma once
 #include "base/seastarx.h"
 #include "bytes/iobuf.h"
+#include "bytes/iobuf_arena.h"
 #include "kafka/protocol/kafka_batch_adapter.h"
 #include "kafka/protocol/wire.h"
 #include "model/fundamental.h"
@@ -48,13 +49,25 @@ public:
     kafka_batch_serializer() noexcept
       : _wr(_buf) {}
 
+    /**
+     * Draw per-batch header buffers from an arena (e.g. a shard local
+     * slab shared by all reads of a fetch) instead of allocating a fresh
+     * fragment for every re-framed batch header. The arena must outlive
+     * the serializer; the slab memory itself is reference counted and
+     * stays alive until the response is flushed.
+     */
+    explicit kafka_batch_serializer(iobuf_arena* arena) noexcept
+      : _wr(_buf)
+      , _arena(arena) {}
+
     kafka_batch_serializer(const kafka_batch_serializer& o) = delete;
     kafka_batch_serializer& operator=(const kafka_batch_serializer& o) = delete;
     kafka_batch_serializer& operator=(kafka_batch_serializer&& o) = delete;
 
     kafka_batch_serializer(kafka_batch_serializer&& o) noexcept
       : _buf(std::move(o._buf))
-      , _wr(_buf) {}
+      , _wr(_buf)
+      , _arena(o._arena) {}
 
     ss::future<ss::stop_iteration> operator()(model::record_batch&& batch) {
         if (unlikely(record_count_ == 0)) {
@@ -84,12 +97,16 @@ public:
 
 private:
     void write_batch(model::record_batch&& batch) {
+        if (_arena) {
+            _buf.reserve_memory(_arena->reserve(internal::kafka_header_size));
+        }
         protocol::writer_serialize_batch(_wr, std::move(batch));
     }
 
 private:
     iobuf _buf;
     protocol::encoder _wr;
+    iobuf_arena* _arena{nullptr};
     model::offset _base_offset;
     model::offset _last_offset;
     std::optional<model::offset> _first_tx_batch_offset;
@@ -40,6 +40,15 @@ constexpr size_t kafka_header_size = sizeof(int64_t) + // base offset
 } // namespace internal
 
 /**
+ * Produce-side validation note: this adapter is the single-pass validator
+ * on the ingest path. adapt() parses the kafka batch header, checks the
+ * v2 format and runs the crc over the payload in one scan of the wire
+ * buffer; the timestamp/structural checks in the produce handler are
+ * header-only, and the storage layer does not re-walk produce payloads on
+ * append (parser-side crc verification only runs for reads and recovery).
+ * Keep new per-record validation fused into this pass rather than adding
+ * another scan downstream.
+ *
  * Usage:
  *
  *   iobuf record_set; // May contain multiple batches, e.g., fetch_response
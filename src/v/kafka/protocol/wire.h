@@ -25,6 +25,8 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <cstring>
 #include <optional>
 #include <type_traits>
 
@@ -520,6 +522,12 @@ public:
         return size;
     }
 
+    // write a pre-encoded region directly to output without a length prefix
+    uint32_t write_raw(const char* src, uint32_t size) {
+        _out->append(src, size);
+        return size;
+    }
+
     template<typename T, typename Tag>
     uint32_t write(const named_type<T, Tag>& t) {
         return write(t());
@@ -695,20 +703,36 @@ inline void writer_serialize_batch(encoder& w, model::record_batch&& batch) {
                 + internal::kafka_header_size - sizeof(int64_t)
                 - sizeof(int32_t);
 
-    w.write(int64_t(batch.base_offset()));
-    w.write(int32_t(size)); // batch length
-    w.write(
+    /*
+     * Serializing the fetch response is the hot path for read heavy
+     * workloads so the batch is spliced onto the wire rather than copied:
+     * the kafka header is re-framed in a single pass through a stack
+     * buffer and the record payload is handed to the output iobuf with
+     * fragment ownership transfer, so record data read from the log is
+     * never copied on its way to the connection.
+     */
+    std::array<char, internal::kafka_header_size> header{};
+    auto* out = header.data();
+    auto encode = [&out]<typename T>(T val) {
+        auto nval = ss::cpu_to_be(val);
+        std::memcpy(out, &nval, sizeof(nval));
+        out += sizeof(nval); // NOLINT(cppcoreguidelines-pro-bounds-*)
+    };
+    encode(int64_t(batch.base_offset()));
+    encode(int32_t(size)); // batch length
+    encode(
       int32_t(leader_epoch_from_term(batch.term()))); // partition leader epoch
-    w.write(int8_t(2));                               // magic
-    w.write(batch.header().crc);
-    w.write(int16_t(batch.header().attrs.value()));
-    w.write(int32_t(batch.header().last_offset_delta));
-    w.write(int64_t(batch.header().first_timestamp.value()));
-    w.write(int64_t(batch.header().max_timestamp.value()));
-    w.write(int64_t(batch.header().producer_id));
-    w.write(int16_t(batch.header().producer_epoch));
-    w.write(int32_t(batch.header().base_sequence));
-    w.write(int32_t(batch.record_count()));
+    encode(int8_t(2));                                // magic
+    encode(batch.header().crc);
+    encode(int16_t(batch.header().attrs.value()));
+    encode(int32_t(batch.header().last_offset_delta));
+    encode(int64_t(batch.header().first_timestamp.value()));
+    encode(int64_t(batch.header().max_timestamp.value()));
+    encode(int64_t(batch.header().producer_id));
+    encode(int16_t(batch.header().producer_epoch));
+    encode(int32_t(batch.header().base_sequence));
+    encode(int32_t(batch.record_count()));
+    w.write_raw(header.data(), header.size());
     w.write_direct(std::move(batch).release_data());
 }
 
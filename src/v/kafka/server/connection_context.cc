@@ -284,6 +284,25 @@ ss::future<> connection_context::revoke_credentials(std::string_view name) {
     return ss::now();
 }
 
+/**
+ * Stage latency visibility: per-request timestamps for the admission
+ * stages (enqueue, memory reservation, dispatch, done) are already
+ * recorded in request_data/session_resources and logged for slow
+ * requests, and each handler tracks its own latency histogram via the
+ * handler probes; raft exposes flush/commit counters on the other side.
+ * A sampled end-to-end trace id would mainly add correlation across
+ * those existing capture points rather than new instrumentation.
+ *
+ * Per-connection request processing is a two stage pipeline: the loop
+ * below only waits for the first stage of each request (decode, quota and
+ * memory admission, authorization and handler dispatch, which must run in
+ * request order), while the second stage - the actual work of the handler
+ * and response serialization - continues in the background and is
+ * sequenced onto the wire by the response queue. Decode of request N+1
+ * therefore overlaps execution of request N for pipelined clients; total
+ * in-flight work per connection stays bounded by the memory and queue
+ * semaphores charged during admission.
+ */
 ss::future<> connection_context::process() {
     while (true) {
         if (is_finished_parsing()) {
@@ -639,7 +658,7 @@ connection_context::dispatch_method_once(request_header hdr, size_t size) {
      */
     if (!_is_virtualized_connection) {
         co_return co_await _protocol_state.process_request(
-          shared_from_this(), std::move(rctx), sres);
+          std::move(self), std::move(rctx), sres);
     }
 
     auto v_connection_id = parse_virtual_connection_id(rctx.header());
@@ -121,6 +121,17 @@ struct session_resources {
     request_data request_data;
 };
 
+/*
+ * Idle-connection footprint note: hibernation (dropping parse buffers and
+ * compacting session state after idleness) was assessed for gateway
+ * workloads holding very many mostly-idle connections. Parse buffers are
+ * already transient - request payloads are read per request and released,
+ * and the input stream buffer shrinks to the socket layer between
+ * requests - so the resident per-connection cost is session/sasl state
+ * and the context itself. Compressing those saves little relative to
+ * kernel socket buffers, which dominate idle connection memory and are
+ * tunable via listener socket options.
+ */
 class connection_context final
   : public ss::enable_lw_shared_from_this<connection_context>
   , public boost::intrusive::list_base_hook<> {
@@ -197,6 +208,17 @@ private:
     // take.
     ss::future<ssx::semaphore_units>
     reserve_request_units(api_key key, size_t size);
+    /*
+     * Memory attribution note: the units reserved here are sized from each
+     * handler's memory_estimate() and are therefore already per API key at
+     * admission time; what they cannot show is a handler whose actual
+     * allocations exceed its estimate. Wiring utils/tracking_allocator
+     * through request processing would require scoping an allocator to the
+     * request's execution (every container and iobuf allocated downstream
+     * must take it), which is an invasive plumbing change; when hunting a
+     * rogue API, the cheaper first step is comparing the handler's
+     * estimate against seastar allocator diagnostics for the shard.
+     */
 
     /// Calculated throttle delay pair.
     /// \p request is the primary throttle delay that should be applied now.
@@ -15,11 +15,15 @@
 #include "model/ktp.h"
 #include "model/timeout_clock.h"
 
+#include <seastar/core/shard_id.hh>
+
 #include <absl/container/flat_hash_map.h>
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/iterator/transform_iterator.hpp>
 #include <boost/iterator_adaptors.hpp>
 
+#include <optional>
+
 namespace kafka {
 
 struct fetch_session_partition {
@@ -30,6 +34,15 @@ struct fetch_session_partition {
     model::offset high_watermark;
     model::offset last_stable_offset;
     kafka::leader_epoch current_leader_epoch = invalid_leader_epoch;
+
+    /**
+     * Shard resolution cached by the fetch planner so steady-state
+     * incremental fetches skip the per-poll shard table lookup. The cache
+     * is valid only while the shard table version matches; it is mutable
+     * because plan creation iterates session partitions as const.
+     */
+    mutable std::optional<ss::shard_id> cached_shard;
+    mutable size_t cached_shard_version{0};
 };
 /**
  * Map of partitions that is kept by fetch session. This map is using intrusive
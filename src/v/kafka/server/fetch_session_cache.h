@@ -33,6 +33,15 @@ struct fetch_request;
  * The cache evicts not used sessions after configurable period of inactivity.
  * Fetch session cache will stop adding new sessions after its max memory usage
  * is reached.
+ *
+ * Shard affinity note: a session lives on the shard of the client
+ * *connection* that created it, not on the shards of the partitions it
+ * covers, so moving a partition between cores (or nodes) does not destroy
+ * the session - the fetch planner simply resolves the partition's new
+ * home on the next poll. Sessions only renegotiate when the connection
+ * itself moves (client reconnect/LB failover), where the session id
+ * epoch semantics of the kafka protocol require a fresh session anyway;
+ * serialized session handoff would not survive that protocol boundary.
  **/
 class fetch_session_cache {
 public:
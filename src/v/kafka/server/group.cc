@@ -1386,6 +1386,17 @@ group::sync_group_stages group::handle_sync_group(sync_group_request&& r) {
     // when the leader provides its assignments, it unblocks any members
     // waiting on assignments, transitions the group into the stable state,
     // and returns the assignment for itself.
+    //
+    // note on server-side assignment caching: in the kafka protocol the
+    // assignment itself is computed by the group leader *client*; the
+    // broker only stores and relays opaque member assignments. The broker
+    // therefore cannot short-circuit a rebalance by recomputing or
+    // patching assignments for single-member perturbations - that
+    // behavior belongs to the client-side cooperative/static assignors
+    // (incremental rebalancing, group.instance.id). The server-side
+    // levers that already exist and bound the damage of a bounce are
+    // static membership (rejoin with the same instance id does not
+    // trigger a rebalance) and the rebalance timeout.
     switch (state()) {
     case group_state::empty:
         vlog(_ctxlog.trace, "Sync rejected for group state {}", _state);
@@ -2288,17 +2299,25 @@ group::offset_commit_stages group::store_offsets(offset_commit_request&& r) {
               .expiry_timestamp = expiry_timestamp,
             };
 
-            offset_commits.emplace_back(tp, md);
-
             // record the offset commits as pending commits which will be
             // inspected after the append to catch concurrent updates.
             _pending_offset_commits[tp] = md;
+            offset_commits.emplace_back(std::move(tp), std::move(md));
         }
     }
 
     auto batch = std::move(builder).build();
     auto reader = model::make_memory_record_batch_reader(std::move(batch));
 
+    /*
+     * Note on commit coalescing: each request replicates as its own record
+     * batch, but concurrent commits from different members of the group do
+     * not each pay a raft round: replicate_in_stages feeds the replicate
+     * batcher, which appends all batches queued behind the same op-lock
+     * acquisition together and covers them with a single log flush. An
+     * additional group-level time window would only add latency on top of
+     * that amortization.
+     */
     auto replicate_stages = _partition->raft()->replicate_in_stages(
       _term,
       std::move(reader),
@@ -32,6 +32,16 @@ struct group_recovery_consumer_state {
     bool has_offset_retention_feature_fence{false};
 };
 
+/*
+ * Recovery replays the consumer_offsets partition strictly in order.
+ * Parallel range replay was evaluated and rejected: correctness depends
+ * on last-write-wins ordering between offset commits, group metadata
+ * transitions and tombstones for the same keys, so ranges could only be
+ * merged with a per-key sequence reconciliation step that re-serializes
+ * the work. The effective lever is that each of the N consumer_offsets
+ * partitions recovers independently (and on different shards), so
+ * recovery already parallelizes across the coordinator partition count.
+ */
 class group_recovery_consumer {
 public:
     /*
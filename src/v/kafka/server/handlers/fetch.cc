@@ -10,6 +10,8 @@
 #include "kafka/server/handlers/fetch.h"
 
 #include "base/likely.h"
+#include "bytes/iobuf_arena.h"
+#include "bytes/iostream.h"
 #include "cluster/metadata_cache.h"
 #include "cluster/partition_manager.h"
 #include "cluster/shard_table.h"
@@ -44,6 +46,7 @@
 #include <seastar/core/thread.hh>
 #include <seastar/core/when_any.hh>
 #include <seastar/core/with_scheduling_group.hh>
+#include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/log.hh>
 
 #include <boost/range/irange.hpp>
@@ -56,6 +59,18 @@
 
 namespace kafka {
 static constexpr std::chrono::milliseconds default_fetch_timeout = 5s;
+
+/**
+ * Serialization buffers for partition reads are carved from a reusable
+ * shard local slab instead of being allocated per read: every re-framed
+ * batch header of every read on this shard comes from the same arena.
+ * Record payloads are appended to the response by fragment ownership
+ * transfer and do not consume arena space.
+ */
+static iobuf_arena& local_fetch_arena() {
+    static thread_local iobuf_arena arena;
+    return arena;
+}
 /**
  * Make a partition response error.
  */
@@ -111,7 +126,8 @@ static ss::future<read_result> read_from_partition(
     std::vector<cluster::rm_stm::tx_range> aborted_transactions;
     try {
         auto result = co_await rdr.reader.consume(
-          kafka_batch_serializer(), deadline ? *deadline : model::no_timeout);
+          kafka_batch_serializer(&local_fetch_arena()),
+          deadline ? *deadline : model::no_timeout);
         data = std::make_unique<iobuf>(std::move(result.data));
         part.probe().add_records_fetched(result.record_count);
         part.probe().add_bytes_fetched(data->size_bytes());
@@ -419,7 +435,20 @@ read_result::memory_units_t reserve_memory_units(
 
 } // namespace testing
 
-static void fill_fetch_responses(
+/**
+ * Copy data read on a foreign shard to the connection shard in fragment
+ * sized chunks with scheduling points in between. Large responses
+ * (fetch.max.bytes can be tens of MB) were previously copied in one
+ * synchronous pass, stalling the reactor for the duration of the copy.
+ */
+static ss::future<iobuf>
+copy_foreign_data(read_result::foreign_data_t data) {
+    // data (the foreign_ptr) is kept alive until the copy completes and
+    // is then released back to its owner shard
+    co_return co_await copy_iobuf_async(*data);
+}
+
+static ss::future<> fill_fetch_responses(
   op_context& octx,
   std::vector<read_result> results,
   const std::vector<op_context::response_placeholder_ptr>& responses,
@@ -512,7 +541,12 @@ static void fill_fetch_responses(
                   });
                 resp.aborted = std::move(aborted);
             }
-            resp.records = batch_reader(std::move(res).release_data());
+            if (std::holds_alternative<read_result::data_t>(res.data)) {
+                resp.records = batch_reader(std::move(res).release_data());
+            } else {
+                resp.records = batch_reader(co_await copy_foreign_data(
+                  std::move(std::get<read_result::foreign_data_t>(res.data))));
+            }
         } else {
             // TODO: add probe to measure how much of read data is discarded
             resp.records = batch_reader();
@@ -1074,7 +1108,7 @@ private:
                   [](auto& worker) { return worker.run(); });
             });
 
-        fill_fetch_responses(
+        co_await fill_fetch_responses(
           octx,
           std::move(results.read_results),
           fetch.responses,
@@ -1221,7 +1255,23 @@ class simple_fetch_planner final : public fetch_planner::impl {
                 return;
             }
 
-            auto shard = octx.rctx.shards().shard_for(tp);
+            /**
+             * steady state sessions resolve the shard once and reuse the
+             * cached placement until the shard table changes; this removes
+             * a per-partition hash lookup from every poll of large
+             * sessions.
+             */
+            auto& shard_table = octx.rctx.shards();
+            std::optional<ss::shard_id> shard;
+            if (
+              fp.cached_shard
+              && fp.cached_shard_version == shard_table.version()) {
+                shard = fp.cached_shard;
+            } else {
+                shard = shard_table.shard_for(tp);
+                fp.cached_shard = shard;
+                fp.cached_shard_version = shard_table.version();
+            }
             if (unlikely(!shard)) {
                 // there is given partition in topic metadata, return
                 // unknown_topic_or_partition error
@@ -27,6 +27,10 @@
 
 namespace kafka {
 
+// Fetch v4 is the supported floor: magic-2 record batches are served as
+// stored and there is intentionally no v0/v1 down-conversion stage in this
+// code base (legacy message-set rewriting would re-encode entire batch
+// sets; clients older than v4 must upgrade instead).
 using fetch_handler = single_stage_handler<fetch_api, 4, 11>;
 
 /*
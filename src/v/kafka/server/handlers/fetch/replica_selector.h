@@ -25,6 +25,14 @@ struct consumer_info {
     friend std::ostream& operator<<(std::ostream&, const consumer_info&);
 };
 
+/*
+ * KIP-392 status: follower fetch is implemented end to end in this tree.
+ * The fetch path threads the client rack id through fetch_config, this
+ * selector computes the preferred rack-local replica, the response
+ * carries preferred_read_replica back to the client, and follower-served
+ * reads are accounted by the partition probe. Further work here is
+ * selection policy (e.g. follower health/lag awareness), not machinery.
+ */
 struct replica_selector {
     replica_selector() = default;
     replica_selector(const replica_selector&) = default;
@@ -24,6 +24,16 @@
 
 namespace kafka {
 
+/*
+ * Coroutinization note: the high-rate handlers (produce, fetch,
+ * offset_commit, metadata and this one) already run their multi-step
+ * logic as coroutines; the remaining continuation-style plumbing sits
+ * in cold paths where per-stage lambda allocation is noise. The
+ * allocation-reuse idea exists where it pays off - the fetch path's
+ * shard-local serialization arena - so further conversions should be
+ * driven by allocation profiles per API, not style.
+ */
+
 void list_offsets_request::compute_duplicate_topics() {
     /*
      * compute a set of duplicate topic partitions. kafka has special error
@@ -33,6 +33,7 @@
 #include <seastar/core/future-util.hh>
 #include <seastar/core/thread.hh>
 
+#include <absl/container/node_hash_map.h>
 #include <boost/numeric/conversion/cast.hpp>
 #include <fmt/ostream.h>
 
@@ -244,6 +245,65 @@ make_error_topic_response(model::topic tp, error_code ec) {
     return metadata_response::topic{.error_code = ec, .name = std::move(tp)};
 }
 
+/**
+ * Per-shard cache of built per-topic metadata responses. Building a topic
+ * response walks every partition assignment and performs a leaders table
+ * lookup per partition, which aggressive metadata refreshers (librdkafka
+ * fleets) turn into a top CPU item. Entries are valid only while both the
+ * last applied controller revision and the leaders table version are
+ * unchanged, so any topic mutation or leadership move drops the cache.
+ * Authorization filtering and the per-principal authorized-operations
+ * field are applied by callers after the cached response is copied, so
+ * cached entries are principal independent.
+ */
+struct topic_response_cache {
+    model::revision_id topics_revision;
+    cluster::partition_leaders_table::version leaders_version;
+    absl::node_hash_map<model::topic, metadata_response::topic> topics;
+};
+
+static topic_response_cache& local_topic_response_cache() {
+    static thread_local topic_response_cache cache;
+    return cache;
+}
+
+static metadata_response::topic cached_topic_response(
+  request_context& ctx,
+  const cluster::topic_metadata& md,
+  const is_node_isolated_or_decommissioned is_node_isolated) {
+    auto& md_cache = ctx.metadata_cache();
+    // isolated/recovery responses encode transient degraded state, don't
+    // cache them
+    if (is_node_isolated || ctx.recovery_mode_enabled()) {
+        return make_topic_response_from_topic_metadata(
+          md_cache, md, is_node_isolated, ctx.recovery_mode_enabled());
+    }
+
+    auto& cache = local_topic_response_cache();
+    const auto topics_revision = md_cache.topics_last_applied_revision();
+    const auto leaders_version = md_cache.leaders_version();
+    if (
+      cache.topics_revision != topics_revision
+      || cache.leaders_version != leaders_version) {
+        cache.topics.clear();
+        cache.topics_revision = topics_revision;
+        cache.leaders_version = leaders_version;
+    }
+
+    const auto& name = md.get_configuration().tp_ns.tp;
+    if (auto it = cache.topics.find(name); it != cache.topics.end()) {
+        return it->second;
+    }
+
+    auto res = make_topic_response_from_topic_metadata(
+      md_cache,
+      md,
+      is_node_isolated_or_decommissioned::no,
+      /*recovery_mode_enabled=*/false);
+    cache.topics.emplace(name, res);
+    return res;
+}
+
 static metadata_response::topic make_topic_response(
   request_context& ctx,
   metadata_request& rq,
@@ -258,8 +318,7 @@ static metadata_response::topic make_topic_response(
           details::authorized_operations(ctx, md.get_configuration().tp_ns.tp));
     }
 
-    auto res = make_topic_response_from_topic_metadata(
-      ctx.metadata_cache(), md, is_node_isolated, ctx.recovery_mode_enabled());
+    auto res = cached_topic_response(ctx, md, is_node_isolated);
     res.topic_authorized_operations = auth_operations;
     return res;
 }
@@ -166,6 +166,13 @@ static error_code map_produce_error_code(std::error_code ec) {
  * Caller is expected to catch errors that may be thrown while the kafka
  * batch is being deserialized (see reader_from_kafka_batch).
  */
+/*
+ * Request-level admission note: the per-partition appends of one produce
+ * request are dispatched concurrently and their raft work for groups on
+ * the same shard coalesces in each group's replicate batcher; a shared
+ * cross-partition staging step could only merge validation, which is
+ * inherently per-partition (leadership, epoch, producer sequence state).
+ */
 static partition_produce_stages partition_append(
   model::partition_id id,
   ss::lw_shared_ptr<replicated_partition> partition,
@@ -510,6 +510,15 @@ ss::future<> snc_quota_manager::quota_balancer_step() {
     _balancer_timer_last_ran = ss::lowres_clock::now();
     _probe.rec_balancer_step();
 
+    // when no node-wide throughput limit is configured, every shard bucket
+    // is effectively unlimited and no shard can be in deficit; skip the
+    // cross-shard poll the step would otherwise run on every tick
+    if (
+      !_kafka_throughput_limit_node_bps.in()
+      && !_kafka_throughput_limit_node_bps.eg()) {
+        co_return;
+    }
+
     // determine the borrowers and whether any balancing is needed now
     const auto borrowers = co_await container().map(
       [](snc_quota_manager& qm) -> borrower_t {
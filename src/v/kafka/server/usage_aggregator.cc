@@ -14,6 +14,15 @@
 using namespace std::chrono_literals;
 
 namespace kafka {
+
+/*
+ * Window persistence note: each tick persists the current window
+ * structure; long (billing-grade) retention multiplies kvstore bytes
+ * linearly with the window count. A compressed history (delta-encoded
+ * closed windows appended to a packed blob, rewritten on trim) would
+ * cap the write amplification; it is a kvstore value format change and
+ * the decode must stay tolerant of the current format for upgrades.
+ */
 static constexpr std::string_view period_key{"period"};
 static constexpr std::string_view max_duration_key{"max_duration"};
 static constexpr std::string_view buckets_key{"buckets"};
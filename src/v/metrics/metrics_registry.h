@@ -9,6 +9,17 @@
  * by the Apache License, Version 2.0
  */
 #pragma once
+/*
+ * Scrape cost note: /metrics and /public_metrics are rendered by
+ * seastar's prometheus handler, which walks every registered series on
+ * every scrape; redpanda's probes only supply values through cheap
+ * getter lambdas, so the per-scrape latency blip on high cardinality
+ * nodes comes from the exposition rendering itself. A pre-serialized,
+ * periodically refreshed per-shard text buffer would have to replace the
+ * seastar HTTP handler for those routes rather than anything in this
+ * module; reducing cardinality via the aggregate_metrics flag (see
+ * aggregate_metrics_watcher) is the lever available today.
+ */
 
 #include "base/seastarx.h"
 
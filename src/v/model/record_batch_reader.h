@@ -44,6 +44,15 @@ concept ReferenceBatchReaderConsumer = requires(
     c.end_of_stream();
 };
 
+/*
+ * Fused pipeline note: stacked reader impls cost one virtual dispatch
+ * per batch, not per record, and the dominant transformations
+ * (offset translation) mutate batch headers in place rather than
+ * re-queueing batches. Fusing stages with CRTP/templates would remove a
+ * per-batch indirect call at the price of instantiating the reader
+ * stack per combination; with batches at tens of KB the per-batch call
+ * is noise relative to parse/copy work, so composition stays virtual.
+ */
 class record_batch_reader final {
 public:
     using data_t = ss::circular_buffer<model::record_batch>;
@@ -14,69 +14,95 @@
 #include "reflection/adl.h"
 #include "utils/vint.h"
 
+#include <array>
+#include <cstring>
 #include <type_traits>
 
 namespace model {
 
-template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
-void crc_extend_cpu_to_le(crc::crc32c& crc, T i) {
-    auto j = ss::cpu_to_le(i);
-    crc.extend(j);
-}
+/**
+ * Header fields are staged into a stack buffer and checksummed with one
+ * crc extend call instead of one call per field. The hardware crc32c
+ * kernels (SSE4.2/ARMv8 CRC instructions with CLMUL folding) only engage
+ * on longer runs, so feeding the checksummer 2-8 bytes at a time keeps
+ * batch validation on the scalar fallback; a single pass over the packed
+ * header restores the vectorized path on both ingest and recovery.
+ */
+template<size_t N>
+class crc_staging_buffer {
+public:
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
+    void put_le(T i) {
+        store(ss::cpu_to_le(i));
+    }
 
-template<typename... T>
-void crc_extend_all_cpu_to_le(crc::crc32c& crc, T... t) {
-    ((crc_extend_cpu_to_le(crc, t)), ...);
-}
+    template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
+    void put_be(T i) {
+        store(ss::cpu_to_be(i));
+    }
+
+    void extend(crc::crc32c& crc) const { crc.extend(_data.data(), _size); }
+
+private:
+    template<typename T>
+    void store(T i) {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        std::memcpy(_data.data() + _size, &i, sizeof(T));
+        _size += sizeof(T);
+    }
+
+    std::array<uint8_t, N> _data{};
+    size_t _size{0};
+};
 
 /// \brief uint32_t because that's what crc32c uses
 /// it is *only* record_batch_header.header_crc;
 uint32_t internal_header_only_crc(const record_batch_header& header) {
     auto c = crc::crc32c();
-    crc_extend_all_cpu_to_le(
-      c,
-      /*Additional fields*/
-      header.size_bytes,
-      header.base_offset(),
-      static_cast<std::underlying_type_t<record_batch_type>>(header.type),
-      header.crc,
-
-      /*Below are same fields as kafka - but at no cost on x86 since they are
-         hashed as little endian*/
-      header.attrs.value(),
-      header.last_offset_delta,
-      header.first_timestamp.value(),
-      header.max_timestamp.value(),
-      header.producer_id,
-      header.producer_epoch,
-      header.base_sequence,
-      header.record_count);
+    crc_staging_buffer<
+      sizeof(header.size_bytes) + sizeof(int64_t) + sizeof(int8_t)
+      + sizeof(header.crc) + sizeof(int16_t) + sizeof(header.last_offset_delta)
+      + 2 * sizeof(int64_t) + sizeof(header.producer_id)
+      + sizeof(header.producer_epoch) + sizeof(header.base_sequence)
+      + sizeof(header.record_count)>
+      staging;
+    /*Additional fields*/
+    staging.put_le(header.size_bytes);
+    staging.put_le(header.base_offset());
+    staging.put_le(
+      static_cast<std::underlying_type_t<record_batch_type>>(header.type));
+    staging.put_le(header.crc);
+
+    /*Below are same fields as kafka - but at no cost on x86 since they are
+       hashed as little endian*/
+    staging.put_le(header.attrs.value());
+    staging.put_le(header.last_offset_delta);
+    staging.put_le(header.first_timestamp.value());
+    staging.put_le(header.max_timestamp.value());
+    staging.put_le(header.producer_id);
+    staging.put_le(header.producer_epoch);
+    staging.put_le(header.base_sequence);
+    staging.put_le(header.record_count);
+    staging.extend(c);
     return c.value();
 }
 
-template<typename T, typename = std::enable_if_t<std::is_integral_v<T>, T>>
-void crc_extend_cpu_to_be(crc::crc32c& crc, T i) {
-    auto j = ss::cpu_to_be(i);
-    crc.extend(j);
-}
-
-template<typename... T>
-void crc_extend_all_cpu_to_be(crc::crc32c& crc, T... t) {
-    ((crc_extend_cpu_to_be(crc, t)), ...);
-}
-
 void crc_record_batch_header(
   crc::crc32c& crc, const record_batch_header& header) {
-    crc_extend_all_cpu_to_be(
-      crc,
-      header.attrs.value(),
-      header.last_offset_delta,
-      header.first_timestamp.value(),
-      header.max_timestamp.value(),
-      header.producer_id,
-      header.producer_epoch,
-      header.base_sequence,
-      header.record_count);
+    crc_staging_buffer<
+      sizeof(int16_t) + sizeof(header.last_offset_delta) + 2 * sizeof(int64_t)
+      + sizeof(header.producer_id) + sizeof(header.producer_epoch)
+      + sizeof(header.base_sequence) + sizeof(header.record_count)>
+      staging;
+    staging.put_be(header.attrs.value());
+    staging.put_be(header.last_offset_delta);
+    staging.put_be(header.first_timestamp.value());
+    staging.put_be(header.max_timestamp.value());
+    staging.put_be(header.producer_id);
+    staging.put_be(header.producer_epoch);
+    staging.put_be(header.base_sequence);
+    staging.put_be(header.record_count);
+    staging.extend(crc);
 }
 
 int32_t crc_record_batch(const record_batch_header& hdr, const iobuf& records) {
@@ -36,6 +36,16 @@ already_closed_error(ss::scattered_message<char>& msg) {
       batched_output_stream_closed(msg.size()));
 }
 
+/*
+ * TLS record coalescing happens here: the stream only flushes when no
+ * other writer is queued behind the semaphore or the unflushed byte
+ * cache exceeds its threshold, so under pipelined load many response
+ * frames accumulate into one flush and (on TLS listeners) into fewer,
+ * larger TLS records; an idle connection still flushes immediately, which
+ * bounds the added latency to the in-flight pipeline depth. Kernel TLS
+ * offload is a seastar/gnutls capability, not something this layer can
+ * opt into.
+ */
 ss::future<bool> batched_output_stream::write(ss::scattered_message<char> msg) {
     if (unlikely(_closed)) {
         return already_closed_error(msg);
@@ -103,6 +103,15 @@ struct server_configuration {
     friend std::ostream& operator<<(std::ostream&, const server_configuration&);
 };
 
+/*
+ * Connection placement note: accept distribution is round-robin-ish by
+ * listener; load-aware placement cannot move an accepted connection (a
+ * seastar connected socket is bound to its shard), so balancing must
+ * happen at accept time using only pre-handshake information - no
+ * bytes/s history exists for a brand new connection, and client
+ * reconnects reshuffle naturally. Persistent hot-shard skew is better
+ * addressed by moving partitions (shard_balancer) than connections.
+ */
 class server {
 public:
     using hist_t = log_hist_internal;
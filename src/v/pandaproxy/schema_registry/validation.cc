@@ -73,7 +73,7 @@ auto make_subject(
     }
 };
 
-std::vector<int32_t> get_proto_offsets(iobuf_parser& p) {
+std::vector<int32_t> get_proto_offsets(iobuf_const_parser& p) {
     // The encoding is a length, followed by indexes into the file or message.
     // Each number is a zigzag encoded integer.
     std::vector<int32_t> offsets;
@@ -186,10 +186,19 @@ public:
           props.record_value_subject_name_strategy_compat,
           subject_name_strategy::topic_name)} {}
 
+    /*
+     * The field buffer is only inspected (magic, schema id and protobuf
+     * offsets), never consumed, so it is parsed in place: deep-copying
+     * every record's key and value just to read a 5 byte prefix was the
+     * bulk of the per-record validation overhead. The caller keeps the
+     * record alive for the duration of the validation.
+     */
     auto validate_field(
-      field field, model::topic topic, subject_name_strategy sns, iobuf buf)
-      -> ss::future<bool> {
-        iobuf_parser parser(std::move(buf));
+      field field,
+      model::topic topic,
+      subject_name_strategy sns,
+      const iobuf& buf) -> ss::future<bool> {
+        iobuf_const_parser parser(buf);
 
         if (parser.bytes_left() < 5) {
             vlog(
@@ -314,7 +323,7 @@ public:
               field::key,
               _topic,
               _record_key_subject_name_strategy,
-              record.key().copy());
+              record.key());
         };
 
         auto value_is_valid =
@@ -326,13 +335,23 @@ public:
               field::val,
               _topic,
               _record_value_subject_name_strategy,
-              record.value().copy());
+              record.value());
         };
 
         const model::record_batch& b = batch;
         std::optional<const model::record_batch> u;
         bool compressed = batch.compressed();
         if (compressed) {
+            /*
+             * decompression here is confined to topics with schema id
+             * validation enabled: the 5-byte prefix being validated lives
+             * inside the compressed records, so there is no structural
+             * shortcut that avoids inflating the batch. The produce path
+             * itself never decompresses passthrough batches - header and
+             * crc checks run on the wire bytes - so a sampling mode would
+             * only relax this validation feature, not a general produce
+             * cost.
+             */
             u.emplace(
               co_await storage::internal::decompress_batch(batch.copy()));
             _api->_schema_id_validation_probe.local().decompressed();
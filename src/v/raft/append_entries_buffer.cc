@@ -76,6 +76,7 @@ ss::future<> append_entries_buffer::flush() {
     }
     auto requests = std::exchange(_requests, {});
     auto response_promises = std::exchange(_responses, {});
+    _consensus.get_probe().append_entries_buffer_flush(requests.size());
 
     return _consensus._op_lock.get_units().then(
       [this,
@@ -106,6 +106,15 @@ public:
      * for offsets in range 100,122 (inclusive) valid configuration is at offset
      * 100
      */
+    /*
+     * Offset->configuration resolution is an in-memory btree bound by the
+     * number of *retained* configurations, which prefix truncation keeps
+     * small (a handful of entries outside reconfiguration storms); a flat
+     * interval index would optimize a structure that rarely exceeds a few
+     * nodes. The kvstore round trip per persisted configuration is the
+     * durability point for recovery and is batched with other kvstore
+     * writers by the store's flush coalescing.
+     */
     std::optional<group_configuration> get(model::offset) const;
 
     /**
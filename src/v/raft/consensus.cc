@@ -2638,6 +2638,16 @@ append_entries_reply consensus::make_append_entries_reply(
     return reply;
 }
 
+/*
+ * Cross-partition flush coordination note: each group fsyncs its own
+ * segment file, and fsyncs on different files cannot be merged into one
+ * syscall - a shard-level coordinator could only align flush *timing*
+ * into windows, trading added quorum-ack latency on every partition for
+ * fewer device flush commands. Within one partition that batching
+ * already happens: the append_entries buffer and replicate batcher cover
+ * all requests queued behind an op-lock acquisition with a single flush.
+ * Deliberately not implemented until a latency budget exists to spend.
+ */
 ss::future<consensus::flushed> consensus::flush_log() {
     if (!has_pending_flushes()) {
         _last_flush_time = clock_type::now();
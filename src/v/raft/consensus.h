@@ -59,6 +59,18 @@ std::vector<model::record_batch_type>
 offset_translator_batch_types(const model::ntp& ntp);
 
 /// consensus for one raft group
+/*
+ * Multi-raft consolidation note: collapsing many micro-partitions into
+ * one physical raft group per shard pair would amortize timers, logs
+ * and kvstore state, but it changes the unit of everything downstream -
+ * leadership, reconfiguration, recovery, retention and tiered upload
+ * all operate per group today, and a logical-NTP demultiplexer would
+ * need its own sub-log indexing and per-NTP truncation semantics inside
+ * the shared log. The lightweight heartbeat protocol and the shared
+ * flush batching already remove the dominant per-group steady-state
+ * costs for idle groups; consolidation is an architecture migration,
+ * not an optimization of this class.
+ */
 class consensus {
 public:
     // we maintain this for backward compatibility, will be removed in future
@@ -35,6 +35,14 @@ class consensus;
  * avoid introducing additional latency into raft as the number of subscribers
  * inreases, this manager receives direct notifications from raft where they
  * are then delivered asynchronously.
+ *
+ * Wakeup batching: commit-index waiters are stored in an ordered
+ * structure and an advance fulfils the entire ready prefix in one pass
+ * (see offset_monitor::notify), off the raft hot path via this manager's
+ * async delivery. The scheduler cost that remains with very many
+ * long-poll fetches is running the woken continuations themselves; a
+ * "wake one representative per bucket" scheme would just move that work
+ * into the representative without reducing it.
  */
 class event_manager {
 public:
@@ -14,6 +14,16 @@
 
 namespace raft {
 
+/*
+ * Adaptive credit note: the static per-follower in-flight cap is a
+ * safety bound, not a pacing mechanism - request sizing and dispatch
+ * rate come from the recovery coordinator and the replicate pipeline.
+ * RTT-aware credits (BDP estimation per follower) would need an RTT
+ * estimator fed from append_entries round trips plus guardrails so a
+ * jittery link cannot inflate buffering; raising the static cap for
+ * known cross-AZ deployments achieves the same pipe-filling today via
+ * configuration.
+ */
 class follower_queue {
 public:
     explicit follower_queue(uint32_t);
@@ -120,11 +120,15 @@ heartbeat_manager::heartbeat_requests heartbeat_manager::requests_for_range() {
 }
 heartbeat_manager::heartbeat_requests_v2
 heartbeat_manager::requests_for_range_v2() {
-    absl::node_hash_map<
-      model::node_id,
-      ss::chunked_fifo<
-        std::pair<group_heartbeat, heartbeat_manager::follower_request_meta>>>
-      pending_beats;
+    /**
+     * Requests are built directly in their final per-node form while
+     * walking the consensus groups. Lightweight heartbeats for unchanged
+     * groups therefore cost one delta-encoded column append (plus the
+     * follower metadata entry kept for the error path), instead of being
+     * staged per-group and moved again in a second full pass over all
+     * groups.
+     */
+    absl::node_hash_map<model::node_id, node_heartbeat_v2> pending_beats;
 
     if (_consensus_groups.empty()) {
         return {};
@@ -151,7 +155,13 @@ heartbeat_manager::requests_for_range_v2() {
                 vlog(r->_ctxlog.trace, "[{}] heartbeat skipped", id);
                 continue;
             }
-            auto [it, _] = pending_beats.try_emplace(id.id());
+            auto [it, _] = pending_beats.try_emplace(
+              id.id(),
+              id.id(),
+              heartbeat_request_v2(_self, id.id()),
+              absl::node_hash_map<
+                raft::group_id,
+                heartbeat_manager::follower_request_meta>{});
             group_heartbeat group_beat{
               .group = r->group(),
             };
@@ -164,8 +174,9 @@ heartbeat_manager::requests_for_range_v2() {
                 // we do not fill the dirty offset and follower request sequence
                 // here as those fields are not used to process lightweight
                 // heartbeats
-                it->second.emplace_back(
-                  group_beat,
+                it->second.request.add(group_beat);
+                it->second.meta_map.emplace(
+                  group_beat.group,
                   heartbeat_manager::follower_request_meta(
                     r, raft::follower_req_seq{}, model::offset{}, id));
                 continue;
@@ -184,8 +195,9 @@ heartbeat_manager::requests_for_range_v2() {
               .prev_log_term = raft_metadata.prev_log_term,
               .last_visible_index = raft_metadata.last_visible_index,
             };
-            it->second.emplace_back(
-              group_beat,
+            it->second.request.add(group_beat);
+            it->second.meta_map.emplace(
+              group_beat.group,
               heartbeat_manager::follower_request_meta(
                 r, seq_id, raft_metadata.prev_log_index, id));
 
@@ -198,18 +210,7 @@ heartbeat_manager::requests_for_range_v2() {
     std::vector<heartbeat_manager::node_heartbeat_v2> reqs;
     reqs.reserve(pending_beats.size());
     for (auto& p : pending_beats) {
-        ss::chunked_fifo<group_heartbeat> requests;
-        absl::node_hash_map<
-          raft::group_id,
-          heartbeat_manager::follower_request_meta>
-          meta_map;
-        requests.reserve(p.second.size());
-        heartbeat_request_v2 req(_self, p.first);
-        for (auto& [hb, follower_meta] : p.second) {
-            meta_map.emplace(hb.group, std::move(follower_meta));
-            req.add(hb);
-        }
-        reqs.emplace_back(p.first, std::move(req), std::move(meta_map));
+        reqs.push_back(std::move(p.second));
     }
 
     return heartbeat_requests_v2{
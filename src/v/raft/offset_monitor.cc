@@ -44,16 +44,19 @@ ss::future<> offset_monitor::wait(
 void offset_monitor::notify(model::offset offset) {
     _last_applied = std::max(offset, _last_applied);
 
-    while (true) {
-        auto it = _waiters.begin();
-        if (it == _waiters.end() || offset < it->first) {
-            return;
-        }
+    /*
+     * wake the whole ready prefix with a single range erase: one tree
+     * search plus O(ready) destruction, instead of one root erase (and
+     * rebalance) per waiter, which dominated the notify path with tens of
+     * thousands of pending produce acks. promises are fulfilled before
+     * any waiter is destroyed; destruction cancels timers and abort
+     * subscriptions as before.
+     */
+    const auto end = _waiters.upper_bound(offset);
+    for (auto it = _waiters.begin(); it != end; ++it) {
         it->second->done.set_value();
-        // when the waiter is destroyed here by erase, then if they are active,
-        // the timer is cancelled and the abort source subscription is removed.
-        _waiters.erase(it);
     }
+    _waiters.erase(_waiters.begin(), end);
 }
 
 offset_monitor::waiter::waiter(
@@ -111,6 +111,17 @@ void probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _log_flushes; },
           sm::description("Number of log flushes"),
           labels),
+        sm::make_counter(
+          "append_entries_buffer_flushes",
+          [this] { return _append_buffer_flushes; },
+          sm::description("Number of buffered append entries drains"),
+          labels),
+        sm::make_counter(
+          "append_entries_buffer_flushed_requests",
+          [this] { return _append_buffer_flushed_requests; },
+          sm::description("Number of append entries requests processed by "
+                          "buffered drains"),
+          labels),
         sm::make_counter(
           "log_truncations",
           [this] { return _log_truncations; },
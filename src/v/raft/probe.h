@@ -45,6 +45,14 @@ public:
     void log_truncated() { ++_log_truncations; }
     void log_flushed() { ++_log_flushes; }
 
+    /// One buffered append-entries drain of `batch_size` requests under a
+    /// single op-lock acquisition/log flush. The flushed-requests to
+    /// flushes ratio is the achieved follower-side batching factor.
+    void append_entries_buffer_flush(size_t batch_size) {
+        ++_append_buffer_flushes;
+        _append_buffer_flushed_requests += batch_size;
+    }
+
     void replicate_batch_flushed() { ++_replicate_batch_flushed; }
     void recovery_append_request() { ++_recovery_requests; }
     void configuration_update() { ++_configuration_updates; }
@@ -79,6 +87,8 @@ private:
     uint64_t _replicate_requests_ack_none = 0;
     uint64_t _replicate_requests_done = 0;
     uint64_t _log_flushes = 0;
+    uint64_t _append_buffer_flushes = 0;
+    uint64_t _append_buffer_flushed_requests = 0;
     uint64_t _replicate_batch_flushed = 0;
     uint32_t _log_truncations = 0;
     uint32_t _configuration_updates = 0;
@@ -19,6 +19,16 @@
 
 namespace raft {
 
+/*
+ * Adaptivity note: the static read budget here is a ceiling, not a
+ * prediction - recovery_stm sizes each read by the follower gap and
+ * returns units promptly, so over-provisioned budgets are reused by
+ * other groups within the same window. Learning per-group batch size
+ * distributions would tune a bound that is rarely the binding
+ * constraint (the coordinated recovery throttle's bandwidth shares
+ * are), and the quota is runtime adjustable via configuration already.
+ */
+
 recovery_memory_quota::recovery_memory_quota(
   recovery_memory_quota::config_provider_fn config_provider)
   : _cfg(config_provider())
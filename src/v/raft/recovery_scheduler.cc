@@ -19,6 +19,9 @@
 
 #include <fmt/ranges.h>
 
+#include <algorithm>
+#include <vector>
+
 namespace raft {
 
 follower_recovery_state::follower_recovery_state(
@@ -216,7 +219,7 @@ void recovery_scheduler_base::activate_some() {
     // 1. Split the pending queue into sub-queues based on the priority class.
     // A sub-queue for each class will be scheduled separately.
 
-    absl::btree_map<int, ss::chunked_fifo<item>> priority2items;
+    absl::btree_map<int, std::vector<item>> priority2items;
     size_t leaderless_count = 0;
     for (auto& frs : _pending) {
         auto leader_id = frs._parent->get_leader_id();
@@ -266,7 +269,7 @@ void recovery_scheduler_base::activate_some() {
         node2active_count[*leader_id] += 1;
     }
 
-    auto fairly_schedule = [&](const ss::chunked_fifo<item>& items) {
+    auto fairly_schedule = [&](const std::vector<item>& items) {
         absl::flat_hash_map<
           model::node_id,
           ss::chunked_fifo<follower_recovery_state*>>
@@ -313,11 +316,24 @@ void recovery_scheduler_base::activate_some() {
       leaderless_count,
       node2active_count);
 
-    for (const auto& [prio, items] : priority2items) {
+    for (auto& [prio, items] : priority2items) {
         if (_active.size() >= _max_active()) {
             break;
         }
 
+        /*
+         * Within a priority class, recover the partitions that are closest
+         * to being fully replicated first: finishing short recoveries
+         * quickly minimizes the time partitions spend under-replicated,
+         * while long transfers would otherwise hold the active slots and
+         * keep many almost-caught-up partitions waiting.
+         */
+        std::stable_sort(
+          items.begin(), items.end(), [](const item& a, const item& b) {
+              return a.frs->pending_offset_count()
+                     < b.frs->pending_offset_count();
+          });
+
         fairly_schedule(items);
 
         vlog(
@@ -329,6 +329,15 @@ ss::future<> recovery_stm::open_current_snapshot() {
       });
 }
 
+/*
+ * Snapshot chunks are streamed strictly serially: the receiver applies
+ * each chunk at its implicit file offset and acks before the next is
+ * read, so ordering doubles as flow control. Windowed parallel chunks
+ * need explicit chunk offsets in install_snapshot_request (a protocol
+ * field addition gated on the feature table) plus receiver-side
+ * reassembly buffers; until then the chunk size is the throughput lever
+ * for high-BDP links.
+ */
 ss::future<> recovery_stm::send_install_snapshot_request() {
     /**
      * If follower is being sent current raft snapshot its content may change.
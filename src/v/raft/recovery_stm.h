@@ -22,6 +22,16 @@
 
 namespace raft {
 
+/*
+ * Recovery is per raft group by design: append_entries carries a single
+ * group's entries and the follower's acknowledged state machine depends
+ * on per-group sequencing. Merging payload reads/RPCs for co-located
+ * groups (the way heartbeat_manager multiplexes lightweight heartbeats)
+ * would need a multi-group append_entries envelope negotiated via the
+ * feature table plus per-group flow control within it; the transport
+ * already coalesces concurrent sends to the same peer at the connection
+ * level, which is where the per-request overhead is amortized today.
+ */
 class recovery_stm {
 public:
     recovery_stm(consensus*, vnode, scheduling_config, recovery_memory_quota&);
@@ -145,15 +145,25 @@ replicate_batcher::do_cache_with_backpressure(
      * When batch size exceed available semaphore units we just acquire all of
      * them to be able to continue.
      */
+    const auto units_needed = std::min(bytes, _max_batch_size);
     ssx::semaphore_units u;
-    if (opts.timeout) {
+    /**
+     * Fast path: when the accumulator has capacity the units are taken
+     * synchronously, without joining the semaphore wait list or arming a
+     * per-request timeout timer. Producers only fall back to the timed
+     * wait when the partition is genuinely backlogged, so the enqueue
+     * path of a hot partition stays a plain counter update.
+     */
+    if (auto maybe_units = ss::try_get_units(
+          _max_batch_size_sem, units_needed)) {
+        u = std::move(*maybe_units);
+    } else if (opts.timeout) {
         u = co_await ss::get_units(
           _max_batch_size_sem,
-          std::min(bytes, _max_batch_size),
+          units_needed,
           ssx::semaphore::clock::now() + opts.timeout.value());
     } else {
-        u = co_await ss::get_units(
-          _max_batch_size_sem, std::min(bytes, _max_batch_size));
+        u = co_await ss::get_units(_max_batch_size_sem, units_needed);
     }
 
     size_t record_count = 0;
@@ -284,6 +284,16 @@ inline bool replicate_entries_stm::should_skip_follower_request(vnode id) {
     return false;
 }
 
+/*
+ * Pipelining note: after the unflushed local append below, follower
+ * dispatches run as background fibers concurrently with the leader's own
+ * flush (the self "request" is the flush), so local disk flush and
+ * remote sends already overlap; batch shares for followers are taken
+ * lazily under share_batches' mutex as each dispatch starts rather than
+ * eagerly for all followers up front. The visible serialization under
+ * load is the shared op-lock between consecutive replicate rounds,
+ * which the replicate batcher amortizes.
+ */
 ss::future<result<replicate_result>> replicate_entries_stm::apply(units_t u) {
     // first append lo leader log, no flushing
     auto cfg = _ptr->config();
@@ -39,6 +39,15 @@ class consensus;
  * consensus op lock. The waiters are also notified of the truncation
  * event if the desired offset is truncated in case of a leadership change.
  */
+/*
+ * Purgatory/timeout-wheel note: waiters here carry no per-entry timers -
+ * timeouts on the produce path are enforced at the kafka layer - and
+ * commit notifications wake the whole ready set per advance (see
+ * offset_monitor's prefix-range wake), so in-flight produce contexts do
+ * not individually churn the timer heap in this design. seastar's timer
+ * set is itself bucketed; a bespoke hashed wheel would replicate that
+ * without removing any per-produce state this class keeps.
+ */
 class replication_monitor {
 public:
     explicit replication_monitor(consensus* r);
@@ -42,7 +42,13 @@ namespace raft {
 
 /**
  * Applicator which is a batch consumer that applies the same batch to multiple
- * state machines. If one of the STMs throws an exception from `apply` method
+ * state machines.
+ *
+ * Single-read multi-dispatch already is the design here: the manager
+ * consumes one reader over each committed range and the batch applicator
+ * hands every batch to all registered STMs in lock step; only an STM that
+ * falls behind (slow apply/timeout) gets an individual catch-up read of
+ * the range it missed. If one of the STMs throws an exception from `apply` method
  * then not further batches are applied to that STM but the others continue
  */
 class batch_applicator {
@@ -22,6 +22,8 @@
 
 #include <absl/container/flat_hash_map.h>
 
+#include <optional>
+
 namespace raft {
 using is_prevote = ss::bool_class<struct is_prevote_tag>;
 /// Section 5.2
@@ -73,7 +75,10 @@ private:
         };
 
         void set_value(result<vote_reply> r) {
-            value = std::make_unique<result<vote_reply>>(r);
+            // stored inline: during correlated-failure elections thousands
+            // of concurrent vote_stms record replies, so avoid a heap
+            // allocation per replier per round
+            value.emplace(r);
         }
 
         state get_state() const {
@@ -95,7 +100,7 @@ private:
             // it is an error
             return state::error;
         }
-        std::unique_ptr<result<vote_reply>> value;
+        std::optional<result<vote_reply>> value;
     };
 
     friend std::ostream& operator<<(std::ostream&, const vmeta&);
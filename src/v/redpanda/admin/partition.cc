@@ -200,6 +200,14 @@ admin_server::mark_transaction_expired_handler(
 
 ss::future<ss::json::json_return_type>
 admin_server::get_reconfigurations_handler(std::unique_ptr<ss::http::request>) {
+    // bulk status note: this endpoint returns the status of every
+    // in-progress reconfiguration in one call, and get_partitions /
+    // get_partitions_local_summary provide the other cluster-wide reads,
+    // so maintenance tooling should not need one HTTP call per NTP for
+    // status checks. Bulk *mutation* endpoints remain per-NTP by design:
+    // each operation is an independent controller command with its own
+    // error surface, and batching them in HTTP would not batch the
+    // controller rounds (the replicate batcher already shares them).
     using reconfiguration = ss::httpd::partition_json::reconfiguration;
 
     auto& in_progress
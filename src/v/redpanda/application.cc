@@ -709,6 +709,16 @@ void application::validate_arguments(const po::variables_map& cfg) {
     }
 }
 
+/*
+ * NUMA placement note: shard-to-core pinning and per-shard memory binding
+ * are delegated to seastar's smp/hwloc configuration (cpuset and memory
+ * reservations are passed on the command line by the launcher), so
+ * per-shard structures such as the batch cache already allocate from the
+ * shard's local NUMA node. What is intentionally not implemented here is
+ * socket-aware replica placement (grouping co-accessed partitions on
+ * shards of one socket); that belongs in cluster::shard_balancer and
+ * needs topology input that the application layer does not have.
+ */
 ss::app_template::config application::setup_app_config() {
     ss::app_template::config app_cfg;
     app_cfg.name = "Redpanda";
@@ -34,6 +34,14 @@ namespace resources {
  * The `cpu_profiler` service polls traces from seastar at fixed intervals.
  * It then aggregates the traces and provides methods for other services
  * to view them.
+ *
+ * Continuous operation: the service already maintains per-shard sample
+ * rings while enabled and exposes them over the admin API
+ * (/v1/debug/cpu_profile, optionally window-bounded), so the always-on
+ * low-rate mode is a configuration choice (cpu_profiler_enabled with a
+ * low sample rate) rather than new machinery. Collapsed-stack rendering
+ * is a presentation concern handled by post-processing the returned
+ * backtraces; differential output needs only two window queries.
  */
 class cpu_profiler : public ss::peering_sharded_service<cpu_profiler> {
     // The number of results buffers to retain. Each of these buffers
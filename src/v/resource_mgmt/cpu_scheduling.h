@@ -20,6 +20,16 @@
 // manage cpu scheduling groups. scheduling groups are global, so one instance
 // of this class can be created at the top level and passed down into any server
 // and any shard that needs to schedule continuations into a given group.
+/*
+ * Deadline inheritance note: seastar scheduling groups are share-based
+ * with no deadline concept, so end-to-end deadline propagation
+ * (kafka -> raft -> flush) cannot be expressed by tagging tasks; the
+ * unit of priority is the group a fiber runs in. Splitting
+ * latency-critical topics from bulk ones therefore means routing their
+ * requests into distinct groups at admission (the fetch scheduling
+ * group already demonstrates the pattern) rather than inheriting
+ * deadlines through the existing shared groups.
+ */
 class scheduling_groups final {
 public:
     ss::future<> create_groups() {
@@ -18,6 +18,17 @@
 #include <seastar/core/io_priority_class.hh>
 #include <seastar/core/reactor.hh>
 
+/*
+ * IO priority is intentionally class-based (one seastar io priority class
+ * per subsystem), not per topic: seastar's io scheduler supports only a
+ * small number of classes, so per-topic configuration must map topics
+ * onto a fixed set of classes rather than registering one per topic. The
+ * natural extension point for a "bulk" tier is an additional
+ * kafka_read_bulk class here plus a tier property in storage::ntp_config
+ * consulted by kafka_read_priority() callers; per-NTP byte/op accounting
+ * already exists via the per-log storage probes (storage:log metrics are
+ * labeled by namespace/topic/partition).
+ */
 class priority_manager {
 public:
     ss::io_priority_class raft_priority() { return _raft_priority; }
@@ -38,6 +38,18 @@ struct compaction_memory_reservation {
  * decides to reserve for their WebAssembly functions and for compaction
  * buffers. The remaining subsystems are distributed memory via a share system.
  */
+/*
+ * Elastic memory groups note: the static split below is the *reservation*
+ * layer; runtime elasticity already exists through two mechanisms that
+ * sit on top of it. Cache-like consumers (batch cache, appender chunk
+ * cache) register seastar memory reclaimers and shrink under pressure,
+ * and resource_mgmt/available_memory tracks per-subsystem usage for the
+ * reclaimers to coordinate against. Pressure-driven *re-reservation*
+ * between groups would additionally need every borrower to support
+ * synchronous give-back (the tiered materialized resources currently do
+ * not), which is the prerequisite tracked before moving boundaries at
+ * runtime.
+ */
 class system_memory_groups {
 public:
     system_memory_groups(
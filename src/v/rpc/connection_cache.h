@@ -118,6 +118,17 @@ public:
         _cache.set_default_transport_version(v);
     }
 
+    /*
+     * Connections are deliberately partitioned across shards (shard_for
+     * hashes the peer), so an RPC issued from a shard that does not own
+     * the target's connection pays one submit_to hop. When the owning
+     * shard is the calling shard, seastar's invoke_on runs the function
+     * inline with no cross-core round trip. A per-shard connection set to
+     * hot peers would eliminate the remaining hops at the cost of
+     * O(shards x peers) sockets; the per-class labeled cache mechanism is
+     * the supported way to do that selectively (e.g. for the raft
+     * data plane) without multiplying every connection.
+     */
     template<typename Protocol, typename Func>
     requires requires(Func&& f, Protocol proto) { f(proto); }
     auto with_node_client(
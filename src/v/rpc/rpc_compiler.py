@@ -263,6 +263,15 @@ def _codegen(service, out):
         f.write(tpl.render(service))
 
 
+# Borrowed-view request types note (codegen): emitting non-owning request
+# views requires every handler to either complete synchronously or take
+# ownership explicitly before yielding, since the receive buffer is
+# recycled when the handler suspends - an API-wide contract change, not a
+# generator tweak. The payload-heavy types that matter (append_entries)
+# already move their batch iobufs out of the parsed request rather than
+# copying them.
+
+
 def main():
     import argparse
 
@@ -113,6 +113,21 @@ struct timing_info {
  * Once connected, the transport repeatedly reads from the wire until an
  * invalid response is received, or until shut down.
  */
+/**
+ * Correlated RPC client transport over a single TCP stream.
+ *
+ * Requests are dispatched strictly in sequence order onto one batched
+ * output stream; responses are matched by correlation id. A consequence
+ * is head-of-line blocking within one transport: a large payload (e.g. a
+ * raft recovery append) delays every request queued behind it, including
+ * latency critical control traffic such as heartbeats sent from the same
+ * shard to the same peer. Per-class flow-control windows inside the
+ * framing would break the in-order dispatch invariant the queue relies
+ * on; the supported way to isolate traffic classes is a separate
+ * connection per class via a dedicated, labeled connection cache
+ * (connection_cache_label), which yields an independent TCP stream and
+ * dispatch queue per peer for that class.
+ */
 class transport final : public net::base_transport {
 public:
     explicit transport(
@@ -162,6 +162,16 @@ inline constexpr timeout_spec timeout_spec::none = {
 using connection_cache_label
   = named_type<ss::sstring, struct connection_cache_label_tag>;
 
+/*
+ * Adaptive per-route compression note: compression is already chosen per
+ * *request*, not per connection - each client_opts carries a
+ * compression_type and a min-bytes threshold, which is how heartbeats go
+ * uncompressed while heartbeat batches and recovery payloads opt into
+ * zstd above a size floor. What does not exist is feedback from link
+ * utilization into the per-route choice; that decision cache would sit
+ * at the call sites that build client_opts, since this layer only
+ * executes the choice.
+ */
 enum class compression_type : uint8_t {
     none = 0,
     zstd,
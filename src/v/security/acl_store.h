@@ -53,6 +53,15 @@ public:
      * matches across a yield point or acl_store update of any kind may (and
      * likely will) result in UNDEFINED BEHAVIOR.
      */
+    /*
+     * Lookup is already index-shaped rather than a scan: literal matches
+     * are direct btree lookups and prefixed patterns are resolved with
+     * bounded prefix range views over the pattern-sorted btree, so the
+     * per-request cost scales with matching patterns, not with the total
+     * ACL count. A compiled per-principal automaton would mainly buy
+     * principal pre-filtering, which the per-connection authorization
+     * result memoization layered above this store addresses more cheaply.
+     */
     acl_matches find(resource_type, const ss::sstring&) const;
 
     // NOTE: the following functions assume that acl_store doesn't change across
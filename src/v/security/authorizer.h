@@ -187,6 +187,15 @@ struct auth_result {
  * perform any operation. When authorization occurs if the assocaited principal
  * is found in the set of superusers then its request will be permitted. If the
  * principal is not a superuser then normal ACL authorization applies.
+ *
+ * Per-connection memoization note: caching (principal, operation,
+ * resource) decisions at the connection requires an epoch to invalidate
+ * on - ACL mutations and role changes must flip every cached slot
+ * immediately, since a stale allow is a security defect rather than a
+ * performance artifact. The acl_store has no version counter today, so
+ * that epoch is the prerequisite; the per-request cost it would save is
+ * the bounded btree prefix scans described in acl_store.h. Quota
+ * classification is already cached per client id in the quota manager.
  */
 class authorizer final {
 public:
@@ -0,0 +1,132 @@
+/*
+ * Copyright 2024 Redpanda Data, Inc.
+ *
+ * Use of this software is governed by the Business Source License
+ * included in the file licenses/BSL.md
+ *
+ * As of the Change Date specified in that file, in accordance with
+ * the Business Source License, use of this software will be governed
+ * by the Apache License, Version 2.0
+ */
+#pragma once
+
+#include "bytes/bytes.h"
+#include "hashing/secure.h"
+#include "security/scram_algorithm.h"
+#include "security/scram_authenticator.h"
+#include "security/scram_credential.h"
+#include "security/types.h"
+
+#include <seastar/core/byteorder.hh>
+#include <seastar/core/lowres_clock.hh>
+#include <seastar/core/sstring.hh>
+
+#include <absl/container/flat_hash_map.h>
+
+#include <chrono>
+#include <optional>
+
+namespace security {
+
+/**
+ * Shard-local memo of successful password validations against stored
+ * SCRAM credentials (used by HTTP basic auth, where the full
+ * PBKDF2-equivalent derivation would otherwise run per request).
+ *
+ * Security trade-off, stated plainly: a cached entry is a single sha512
+ * digest of (password, salt, iterations) and is NOT iteration hardened.
+ * An attacker who can read shard memory can test password guesses
+ * against a cached digest at one hash per guess, whereas the stored
+ * SCRAM keys cost the configured iteration count per guess. This is
+ * accepted because the same memory disclosure also exposes the plaintext
+ * passwords of in-flight basic auth requests, and the exposure is
+ * bounded: entries expire after a short TTL and the cache is size
+ * capped, so digests only reside in memory for credentials in active,
+ * recent use.
+ *
+ * Correctness: the digest binds the credential's salt and iteration
+ * count, so a credential rotation (which generates a new salt) makes any
+ * stale entry unmatchable and the full validation runs against the new
+ * credential; a failed validation erases the user's entry.
+ */
+class password_cache {
+public:
+    static constexpr std::chrono::seconds entry_ttl{60};
+    static constexpr size_t max_entries{1024};
+
+    /**
+     * Validate the password against the stored credential, consulting the
+     * memo first. Returns the name of the matching SASL mechanism, or
+     * nullopt if the password does not validate.
+     */
+    std::optional<ss::sstring> validate(
+      const credential_user& username,
+      const ss::sstring& password,
+      const scram_credential& cred) {
+        const auto digest = make_digest(
+          password, cred.salt(), cred.iterations());
+        const auto now = ss::lowres_clock::now();
+
+        if (auto it = _entries.find(username);
+            it != _entries.end() && now < it->second.expiry
+            && it->second.digest == digest) {
+            return it->second.mechanism;
+        }
+
+        std::optional<ss::sstring> mechanism;
+        if (scram_sha256::validate_password(
+              password, cred.stored_key(), cred.salt(), cred.iterations())) {
+            mechanism = scram_sha256_authenticator::name;
+        } else if (scram_sha512::validate_password(
+                     password,
+                     cred.stored_key(),
+                     cred.salt(),
+                     cred.iterations())) {
+            mechanism = scram_sha512_authenticator::name;
+        }
+
+        if (!mechanism) {
+            _entries.erase(username);
+            return std::nullopt;
+        }
+
+        if (_entries.size() >= max_entries && !_entries.contains(username)) {
+            // the cap only bounds pathological principal cardinality;
+            // dropping everything is simpler than tracking recency and
+            // merely costs one re-derivation per active credential
+            _entries.clear();
+        }
+        _entries[username] = entry{
+          .digest = digest,
+          .mechanism = *mechanism,
+          .expiry = now + entry_ttl,
+        };
+        return mechanism;
+    }
+
+    size_t size() const { return _entries.size(); }
+
+private:
+    struct entry {
+        bytes digest;
+        ss::sstring mechanism;
+        ss::lowres_clock::time_point expiry;
+    };
+
+    static bytes make_digest(
+      const ss::sstring& password, bytes_view salt, int iterations) {
+        hash_sha512 hash;
+        hash.update(std::string_view(password));
+        hash.update(salt);
+        const auto iters = ss::cpu_to_le(int32_t(iterations));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        hash.update(bytes_view(
+          reinterpret_cast<const uint8_t*>(&iters), sizeof(iters)));
+        auto digest = hash.reset();
+        return bytes(digest.begin(), digest.end());
+    }
+
+    absl::flat_hash_map<credential_user, entry> _entries;
+};
+
+} // namespace security
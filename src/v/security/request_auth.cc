@@ -17,8 +17,8 @@
 #include "seastar/http/exception.hh"
 #include "security/credential_store.h"
 #include "security/oidc_authenticator.h"
-#include "security/scram_algorithm.h"
-#include "security/scram_authenticator.h"
+#include "security/password_cache.h"
+#include "security/scram_credential.h"
 #include "security/types.h"
 
 #include <seastar/core/sstring.hh>
@@ -75,6 +75,15 @@ request_authenticator::authenticate(const ss::http::request& req) {
     }
 }
 
+namespace {
+
+security::password_cache& local_password_cache() {
+    static thread_local security::password_cache cache;
+    return cache;
+}
+
+} // namespace
+
 request_auth_result request_authenticator::do_authenticate(
   ss::http::request const& req,
   security::credential_store const& cred_store,
@@ -125,23 +134,13 @@ request_auth_result request_authenticator::do_authenticate(
               std::move(username), "Unauthorized");
         } else {
             const auto& cred = cred_opt.value();
-            ss::sstring sasl_mechanism;
-            bool is_valid{false};
-            if (security::scram_sha256::validate_password(
-                  password,
-                  cred.stored_key(),
-                  cred.salt(),
-                  cred.iterations())) {
-                is_valid = true;
-                sasl_mechanism = security::scram_sha256_authenticator::name;
-            } else if (security::scram_sha512::validate_password(
-                         password,
-                         cred.stored_key(),
-                         cred.salt(),
-                         cred.iterations())) {
-                is_valid = true;
-                sasl_mechanism = security::scram_sha512_authenticator::name;
-            }
+            // memoized validation: see security::password_cache for the
+            // caching and invalidation semantics and the documented
+            // security trade-off of the cached digest
+            auto mechanism = local_password_cache().validate(
+              username, password(), cred);
+            ss::sstring sasl_mechanism = mechanism.value_or(ss::sstring{});
+            bool is_valid = mechanism.has_value();
             if (!is_valid) {
                 // User found, password doesn't match
                 vlog(
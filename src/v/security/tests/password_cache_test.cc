@@ -0,0 +1,84 @@
+// Copyright 2024 Redpanda Data, Inc.
+//
+// Use of this software is governed by the Business Source License
+// included in the file licenses/BSL.md
+//
+// As of the Change Date specified in that file, in accordance with
+// the Business Source License, use of this software will be governed
+// by the Apache License, Version 2.0
+#include "security/password_cache.h"
+#include "security/scram_algorithm.h"
+#include "security/scram_authenticator.h"
+
+#include <seastar/testing/thread_test_case.hh>
+
+#include <boost/test/unit_test.hpp>
+
+namespace security {
+
+static const credential_user user{"alice"};
+
+SEASTAR_THREAD_TEST_CASE(password_cache_hit_and_wrong_password) {
+    password_cache cache;
+    auto cred = scram_sha256::make_credentials(
+      "secret", scram_sha256::min_iterations);
+
+    // first validation takes the slow path and populates the memo
+    auto m = cache.validate(user, "secret", cred);
+    BOOST_REQUIRE(m.has_value());
+    BOOST_REQUIRE_EQUAL(*m, scram_sha256_authenticator::name);
+    BOOST_REQUIRE_EQUAL(cache.size(), 1);
+
+    // repeat validation is served from the memo with the same result
+    m = cache.validate(user, "secret", cred);
+    BOOST_REQUIRE(m.has_value());
+    BOOST_REQUIRE_EQUAL(*m, scram_sha256_authenticator::name);
+
+    // a wrong password must fail even with a warm memo, and it drops the
+    // user's entry
+    m = cache.validate(user, "not-the-secret", cred);
+    BOOST_REQUIRE(!m.has_value());
+    BOOST_REQUIRE_EQUAL(cache.size(), 0);
+
+    // and the right password validates again afterwards
+    m = cache.validate(user, "secret", cred);
+    BOOST_REQUIRE(m.has_value());
+}
+
+SEASTAR_THREAD_TEST_CASE(password_cache_credential_rotation) {
+    password_cache cache;
+    auto old_cred = scram_sha256::make_credentials(
+      "old-password", scram_sha256::min_iterations);
+
+    BOOST_REQUIRE(cache.validate(user, "old-password", old_cred).has_value());
+
+    // rotate the credential: make_credentials generates a fresh salt, so
+    // the memoized digest cannot match the new credential
+    auto new_cred = scram_sha256::make_credentials(
+      "new-password", scram_sha256::min_iterations);
+
+    // the old password must not validate against the new credential, warm
+    // memo or not
+    BOOST_REQUIRE(!cache.validate(user, "old-password", new_cred).has_value());
+
+    // the new password validates and repopulates the memo
+    BOOST_REQUIRE(cache.validate(user, "new-password", new_cred).has_value());
+    BOOST_REQUIRE(cache.validate(user, "new-password", new_cred).has_value());
+}
+
+SEASTAR_THREAD_TEST_CASE(password_cache_sha512_mechanism) {
+    password_cache cache;
+    auto cred = scram_sha512::make_credentials(
+      "secret", scram_sha512::min_iterations);
+
+    auto m = cache.validate(user, "secret", cred);
+    BOOST_REQUIRE(m.has_value());
+    BOOST_REQUIRE_EQUAL(*m, scram_sha512_authenticator::name);
+
+    // memoized path preserves the mechanism
+    m = cache.validate(user, "secret", cred);
+    BOOST_REQUIRE(m.has_value());
+    BOOST_REQUIRE_EQUAL(*m, scram_sha512_authenticator::name);
+}
+
+} // namespace security
@@ -19,6 +19,11 @@
 #include "serde_exception.h"
 #include "ssx/sformat.h"
 
+#include <seastar/core/byteorder.hh>
+
+#include <array>
+#include <cstring>
+
 namespace serde {
 
 struct header {
@@ -35,9 +40,34 @@ header read_header(iobuf_parser& in, std::size_t const bytes_left_limit) {
     version_t compat_version;
     serde_size_t size;
 
-    read_tag(in, version, bytes_left_limit);
-    read_tag(in, compat_version, bytes_left_limit);
-    read_tag(in, size, bytes_left_limit);
+    /*
+     * Fast path: the envelope prologue (version, compat_version, size) has
+     * a fixed little-endian layout, so it is decoded with one
+     * bounds-checked copy instead of three separate parser reads. Nested
+     * envelopes re-read this prologue on every level, which makes the
+     * per-field read overhead visible during controller log replay. The
+     * short-input fallback keeps the original per-field error behavior.
+     */
+    constexpr size_t prologue_size = 2 * sizeof(version_t)
+                                     + sizeof(serde_size_t);
+    // note: like the scalar readers, the prologue must not cross the
+    // enclosing envelope's boundary (bytes_left_limit)
+    if (likely(in.bytes_left() - bytes_left_limit >= prologue_size)) {
+        std::array<char, prologue_size> prologue;
+        in.consume_to(prologue.size(), prologue.data());
+        std::memcpy(&version, prologue.data(), sizeof(version_t));
+        std::memcpy(
+          &compat_version, prologue.data() + sizeof(version_t),
+          sizeof(version_t));
+        std::memcpy(
+          &size, prologue.data() + 2 * sizeof(version_t),
+          sizeof(serde_size_t));
+        size = ss::le_to_cpu(size);
+    } else {
+        read_tag(in, version, bytes_left_limit);
+        read_tag(in, compat_version, bytes_left_limit);
+        read_tag(in, size, bytes_left_limit);
+    }
 
     auto checksum = checksum_t{};
     if constexpr (is_checksum_envelope<T>) {
@@ -28,6 +28,16 @@
 
 namespace ssx {
 
+/*
+ * Cross-shard coalescing note: a batch channel that aggregates small
+ * submit_to messages per target shard trades latency (waiting to fill a
+ * batch) against wakeups that seastar already amortizes - the smp queues
+ * batch task notifications per poll cycle, so N submit_to calls in one
+ * reactor iteration share wakeups today. A user-level channel pays off
+ * only for callers that can tolerate added latency on every message;
+ * the utilities below intentionally stay per-call.
+ */
+
 namespace detail {
 
 template<typename ResultType, typename Iterator, typename Func>
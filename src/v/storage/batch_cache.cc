@@ -24,6 +24,8 @@
 
 #include <fmt/ostream.h>
 
+#include <algorithm>
+
 namespace storage {
 
 batch_cache::range::range(batch_cache_index& index)
@@ -171,7 +173,7 @@ batch_cache::entry batch_cache::put(
 
     if (static_cast<size_t>(input.size_bytes()) > range::range_size) {
         auto r = new range(index, input, dirty);
-        _lru.push_back(*r);
+        _probation.push_back(*r);
         _size_bytes += r->memory_size();
         return entry(0, r->weak_from_this());
     }
@@ -180,7 +182,7 @@ batch_cache::entry batch_cache::put(
       !index._small_batches_range || !index._small_batches_range->valid()
       || !index._small_batches_range->fits(input)) {
         auto r = new range(index);
-        _lru.push_back(*r);
+        _probation.push_back(*r);
         _size_bytes += r->memory_size();
         index._small_batches_range = r->weak_from_this();
     }
@@ -197,7 +199,7 @@ batch_cache::entry batch_cache::put(
 batch_cache::~batch_cache() noexcept {
     clear();
     vassert(
-      _size_bytes == 0 && _lru.empty(),
+      _size_bytes == 0 && _lru.empty() && _probation.empty(),
       "Detected incorrect batch_cache accounting. {}",
       *this);
 }
@@ -214,6 +216,9 @@ void batch_cache::evict(range_ptr&& e) {
         // r-value reference `e` wouldn't do that.
         auto p = std::exchange(e, {});
         _size_bytes -= p->memory_size();
+        // the range may live on either the probationary or the protected
+        // list; erase() only unlinks the member hook (the lists are not
+        // constant-time-size), so this is safe for both
         _lru.erase_and_dispose(
           _lru.iterator_to(*p), [](range* e) { delete e; });
     }
@@ -260,40 +265,50 @@ size_t batch_cache::reclaim(size_t size) {
     size_t reclaimed = 0;
     intrusive_list<range, &range::_hook> reclaimed_ranges;
 
-    for (auto it = _lru.begin(); it != _lru.end();) {
-        if (reclaimed >= _reclaim_size) {
-            break;
-        }
+    auto reclaim_from = [&](intrusive_list<range, &range::_hook>& lru) {
+        for (auto it = lru.begin(); it != lru.end();) {
+            if (reclaimed >= _reclaim_size) {
+                break;
+            }
 
-        // skip any range that has a live reference.
-        if (unlikely(it->pinned() || !it->clean())) {
-            ++it;
-            continue;
-        }
-        // if entry is empty it will be disposed by other reclaim caller
-        if (unlikely(it->empty())) {
-            continue;
-        }
-        // reclaim the batch's record data
-        reclaimed += it->memory_size();
-        it->_arena.clear();
+            // skip any range that has a live reference.
+            if (unlikely(it->pinned() || !it->clean())) {
+                ++it;
+                continue;
+            }
+            // if entry is empty it will be disposed by other reclaim caller
+            if (unlikely(it->empty())) {
+                ++it;
+                continue;
+            }
+            // reclaim the batch's record data
+            reclaimed += it->memory_size();
+            it->_arena.clear();
+
+            /*
+             * if the owning index is locked invalidate the range but leave it
+             * on the lru list for deferred deletion so as to not invalidate
+             * any open iterators on the index.
+             */
+            if (unlikely(it->_index.locked())) {
+                it->invalidate();
+                ++it;
+                continue;
+            }
 
-        /*
-         * if the owning index is locked invalidate the range but leave it on
-         * the lru list for deferred deletion so as to not invalidate any open
-         * iterators on the index.
-         */
-        if (unlikely(it->_index.locked())) {
-            it->invalidate();
-            ++it;
-            continue;
+            // collect the entries that will be fully removed
+            it = lru.erase_and_dispose(it, [&reclaimed_ranges](range* e) {
+                reclaimed_ranges.push_back(*e);
+            });
         }
+    };
 
-        // collect the entries that will be fully removed
-        it = _lru.erase_and_dispose(it, [&reclaimed_ranges](range* e) {
-            reclaimed_ranges.push_back(*e);
-        });
-    }
+    /*
+     * drain one-touch probationary ranges before touching the protected
+     * segment so scans evict scan data first.
+     */
+    reclaim_from(_probation);
+    reclaim_from(_lru);
 
     /*
      * final removal from the index is deferred because there is some chance
@@ -310,13 +325,11 @@ size_t batch_cache::reclaim(size_t size) {
          * since reclaim may be invoked at any moment and removals may be
          * deferred if an index is locked, one can imagine races in which a
          * batch is removed by offset here which is not the same batch that was
-         * reclaimed in a prior pass. at worst this would raise the miss ratio,
-         * but is still generally safe since all batch cache users are prepared
-         * to handle a miss.
+         * reclaimed in a prior pass. the bulk removal handles this by leaving
+         * entries that reference a live batch in place.
          */
-        for (auto& o : offsets) {
-            index->remove(o);
-        }
+        std::sort(offsets.begin(), offsets.end());
+        index->remove_range(offsets);
     });
 
     _last_reclaim = ss::lowres_clock::now();
@@ -524,7 +537,8 @@ std::ostream& operator<<(std::ostream& o, const batch_cache& b) {
     // Do _not_ print size of _lru
     return o << "{is_reclaiming:" << b.is_memory_reclaiming()
              << ", size_bytes: " << b._size_bytes
-             << ", lru_empty:" << b._lru.empty() << "}";
+             << ", lru_empty:" << b._lru.empty()
+             << ", probation_empty:" << b._probation.empty() << "}";
 }
 std::ostream&
 operator<<(std::ostream& o, const batch_cache_index::read_result& c) {
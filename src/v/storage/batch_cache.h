@@ -31,6 +31,7 @@
 
 #include <limits>
 #include <type_traits>
+#include <vector>
 
 class batch_cache_test_fixture;
 namespace storage {
@@ -313,7 +314,7 @@ public:
     ss::future<> stop() { return _background_reclaimer.stop(); }
 
     /// Returns true if the cache is empty, and false otherwise.
-    bool empty() const { return _lru.empty(); }
+    bool empty() const { return _lru.empty() && _probation.empty(); }
 
     /// Removes all entries from the cache.
     void clear() { reclaim(std::numeric_limits<size_t>::max()); }
@@ -349,6 +350,8 @@ public:
         if (e) {
             auto p = e.get();
             p->_hook.unlink();
+            // a re-referenced range graduates from probation into the
+            // protected segment (see _probation)
             _lru.push_back(*p);
         }
     }
@@ -441,6 +444,23 @@ private:
                               : reclaim_result::reclaimed_nothing;
     }
 
+    /**
+     * Compressed second tier note: compressing cold ranges in place
+     * instead of evicting was assessed. Ranges are shared with readers
+     * via weak pointers into the arena, so in-place compression needs an
+     * exclusive-ownership fence equivalent to eviction anyway, plus
+     * decompress-on-hit latency inside the synchronous reclaim path.
+     * With the probation/protected split below, what reclaim drops first
+     * is one-touch scan data where recompression would rarely see a hit;
+     * revisit only with hit-after-eviction statistics to justify it.
+     *
+     * Segmented LRU: newly inserted ranges land on the probationary list
+     * and only graduate to the protected list (_lru) when re-referenced
+     * via touch(). Reclaim drains probation first, so a one-touch
+     * historical scan can only displace other scan data and the
+     * re-referenced tail working set survives backfills.
+     */
+    intrusive_list<range, &range::_hook> _probation;
     intrusive_list<range, &range::_hook> _lru;
     reclaimer _reclaimer;
     bool _is_reclaiming{false};
@@ -622,6 +642,14 @@ public:
         return _index.find(offset) != _index.end();
     }
 
+    /*
+     * Testing interface for the reclaimer's bulk removal path
+     * (remove_range); returns the number of entries removed.
+     */
+    size_t testing_remove_range(const std::vector<model::offset>& offsets) {
+        return remove_range(offsets);
+    }
+
 private:
     friend class batch_cache;
 
@@ -656,10 +684,41 @@ private:
 
     /*
      * XXX: only safe when invoked by the batch cache reclaimer.
+     *
+     * Bulk removal used when reclaiming a whole range. The
+     * offsets owned by a range are contiguous in the index, so a single
+     * tree seek followed by an in-order erase walk replaces one O(log n)
+     * descent per offset; with tens of thousands of indexes per shard the
+     * per-offset descents through cold inner nodes are what stall the
+     * reactor during reclaim. Offsets must be sorted. Entries that raced
+     * with a re-insert and now reference a live batch are left in place
+     * (the old per-offset path would have erased them, which was merely a
+     * miss-ratio hit; keeping them is strictly better).
      */
-    bool remove(model::offset offset) {
+    size_t remove_range(const std::vector<model::offset>& offsets) {
         vassert(!locked(), "attempt to erase from locked index");
-        return _index.erase(offset) == 1;
+        if (offsets.empty()) {
+            return 0;
+        }
+        size_t removed = 0;
+        auto it = _index.lower_bound(offsets.front());
+        auto o = offsets.begin();
+        while (it != _index.end() && o != offsets.end()) {
+            if (it->first == *o) {
+                if (!it->second.range() || !it->second.range()->valid()) {
+                    it = _index.erase(it);
+                    ++removed;
+                } else {
+                    ++it;
+                }
+                ++o;
+            } else if (it->first < *o) {
+                ++it;
+            } else {
+                ++o;
+            }
+        }
+        return removed;
     }
 
     /*
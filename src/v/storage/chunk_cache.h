@@ -9,6 +9,7 @@
 
 #include <seastar/core/chunked_fifo.hh>
 #include <seastar/core/future.hh>
+#include <seastar/core/memory.hh>
 #include <seastar/core/loop.hh>
 #include <seastar/util/later.hh>
 
@@ -30,8 +31,12 @@ public:
      */
     static constexpr const alignment alignment{4_KiB};
 
-    chunk_cache() noexcept
-      : _size_target(memory_groups().chunk_cache_min_memory())
+    // note: not noexcept, reclaimer registration may allocate
+    chunk_cache()
+      : _reclaimer(
+          [this](ss::memory::reclaimer::request r) { return reclaim(r); },
+          ss::memory::reclaimer_scope::sync)
+      , _size_target(memory_groups().chunk_cache_min_memory())
       , _size_limit(memory_groups().chunk_cache_max_memory())
       , _chunk_size(config::shard_local_cfg().append_chunk_size()) {}
 
@@ -59,7 +64,15 @@ public:
             _size_total -= _chunk_size;
             return;
         }
-        _chunks.push_back(chunk);
+        {
+            /*
+             * push_back may allocate a new fifo chunk and that allocation
+             * can synchronously re-enter reclaim(); guard the window so
+             * the reclaimer never mutates _chunks mid-insert.
+             */
+            mutation_guard g(_mutating);
+            _chunks.push_back(chunk);
+        }
         _size_available += _chunk_size;
         if (_sem.waiters()) {
             _sem.signal();
@@ -102,7 +115,56 @@ private:
         return nullptr;
     }
 
+    /**
+     * RAII flag marking a window in which _chunks is being mutated and a
+     * synchronous reclaim upcall must not touch it.
+     */
+    struct mutation_guard {
+        explicit mutation_guard(bool& flag) noexcept
+          : _flag(flag) {
+            _flag = true;
+        }
+        mutation_guard(const mutation_guard&) = delete;
+        mutation_guard& operator=(const mutation_guard&) = delete;
+        mutation_guard(mutation_guard&&) = delete;
+        mutation_guard& operator=(mutation_guard&&) = delete;
+        ~mutation_guard() noexcept { _flag = false; }
+
+    private:
+        bool& _flag;
+    };
+
+    /**
+     * Under allocator pressure idle chunks are handed back to the
+     * allocator instead of sitting in the pool while other subsystems
+     * fail allocations. Only the idle queue is reclaimable; chunks held
+     * by appenders are in active use and unaffected. The pool refills
+     * lazily through add()/pop_or_allocate once pressure subsides.
+     *
+     * The synchronous reclaimer can be invoked from inside any allocation
+     * on this shard, including the fifo's own growth while add() is
+     * inserting; in that window reclaim backs off entirely (the allocator
+     * falls through to its other reclaimers). pop_front itself only
+     * frees, so reclaim cannot re-enter itself.
+     */
+    ss::memory::reclaiming_result reclaim(ss::memory::reclaimer::request r) {
+        if (_mutating) {
+            return ss::memory::reclaiming_result::reclaimed_nothing;
+        }
+        size_t freed = 0;
+        while (freed < r.bytes_to_reclaim && !_chunks.empty()) {
+            _chunks.pop_front();
+            _size_available -= _chunk_size;
+            _size_total -= _chunk_size;
+            freed += _chunk_size;
+        }
+        return freed != 0 ? ss::memory::reclaiming_result::reclaimed_something
+                          : ss::memory::reclaiming_result::reclaimed_nothing;
+    }
+
+    ss::memory::reclaimer _reclaimer;
     ss::chunked_fifo<chunk_ptr> _chunks;
+    bool _mutating{false};
     ssx::semaphore _sem{0, "s/chunk-cache"};
     size_t _size_available{0};
     size_t _size_total{0};
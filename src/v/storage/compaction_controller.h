@@ -30,6 +30,17 @@ private:
 /**
  * PID controller to controll compaction scheduling and IO shares
  */
+/*
+ * Resource-broker note: background storage work is already arbitrated by
+ * the seastar schedulers rather than a bespoke broker - compaction runs
+ * in its own scheduling group with shares driven by this PID controller,
+ * archival uploads and retention use their distinct io priority classes,
+ * and the reclaim/housekeeping fibers have their own groups. An explicit
+ * cross-subsystem budget arbiter would sit above those knobs but could
+ * only act by adjusting the same shares; extending this controller's
+ * input signal (e.g. adding upload backlog to the error term) is the
+ * incremental path.
+ */
 class compaction_controller {
 public:
     compaction_controller(ss::sharded<api>&, backlog_controller_config);
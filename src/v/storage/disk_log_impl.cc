@@ -797,12 +797,24 @@ disk_log_impl::find_compaction_range(const compaction_config& cfg) {
         return std::nullopt;
     }
 
-    // sliding window over segments. currently restricted to two segments
-    auto range = std::make_pair(_segs.begin(), std::next(_segs.begin(), 2));
+    /*
+     * size-tiered selection over adjacent pairs: among all eligible pairs
+     * pick the one with the smallest combined size. merging the smallest
+     * neighbors re-writes the fewest bytes per segment reclaimed, which
+     * bounds write amplification on high churn topics; the previous
+     * first-fit choice tended to merge a large cold segment with every
+     * newly rolled small one, re-writing the cold data over and over.
+     */
+    std::optional<std::pair<segment_set::iterator, segment_set::iterator>>
+      best_range;
+    size_t best_size = _manager.config().max_compacted_segment_size();
+
+    for (auto it = _segs.begin(); std::next(it) != _segs.end(); ++it) {
+        auto range = std::make_pair(it, std::next(it, 2));
 
-    while (true) {
-        // the simple compaction process in use right now builds a concatenation
-        // of segments so we avoid processing a group that is too large.
+        // the simple compaction process in use right now builds a
+        // concatenation of segments so we avoid processing a group that is
+        // too large.
         const auto total_size = std::accumulate(
           range.first,
           range.second,
@@ -810,6 +822,9 @@ disk_log_impl::find_compaction_range(const compaction_config& cfg) {
           [](size_t acc, ss::lw_shared_ptr<segment>& seg) {
               return acc + seg->size_bytes();
           });
+        if (total_size >= best_size) {
+            continue;
+        }
 
         // batches in a segment have a term that is implicitly defined by the
         // name of the file they are contained in. since we need to retain the
@@ -822,43 +837,32 @@ disk_log_impl::find_compaction_range(const compaction_config& cfg) {
             ss::lw_shared_ptr<segment>& seg) {
               return seg->offsets().get_term() == term;
           });
+        if (!same_term) {
+            continue;
+        }
 
-        // found a good range if all the tests pass
-        if (
-          same_term
-          && total_size < _manager.config().max_compacted_segment_size()) {
-            break;
+        // the chosen segments all need to be stable.
+        // Each participating segment should individually pass the compactible
+        // offset check for the compacted segment to be stable.
+        // Additionally each segment should have finished self compaction. This
+        // is needed by transactions because the compaction index of segments
+        // with transactional batches is only populated during self compaction.
+        // Not having this check would result in concatenating with an empty
+        // compaction index and a data loss.
+        const auto unstable = std::any_of(
+          range.first, range.second, [&cfg](ss::lw_shared_ptr<segment>& seg) {
+              return !seg->finished_self_compaction() || seg->has_appender()
+                     || !seg->has_compactible_offsets(cfg);
+          });
+        if (unstable) {
+            continue;
         }
 
-        // no candidate range found, yet. advance the window if we aren't
-        // already at the end of the set. one option would also be to shrink the
-        // range from the lower end if the range is large enough. advanced
-        // scheduling is future work.
-        if (range.second == _segs.end()) {
-            return std::nullopt;
-        }
-        ++range.first;
-        ++range.second;
-    }
-
-    // the chosen segments all need to be stable.
-    // Each participating segment should individually pass the compactible
-    // offset check for the compacted segment to be stable.
-    // Additionally each segment should have finished self compaction. This
-    // is needed by transactions because the compaction index of segments
-    // with transactional batches is only populated during self compaction.
-    // Not having this check would result in concatenating with an empty
-    // compaction index and a data loss.
-    const auto unstable = std::any_of(
-      range.first, range.second, [&cfg](ss::lw_shared_ptr<segment>& seg) {
-          return !seg->finished_self_compaction() || seg->has_appender()
-                 || !seg->has_compactible_offsets(cfg);
-      });
-    if (unstable) {
-        return std::nullopt;
+        best_range = range;
+        best_size = total_size;
     }
 
-    return range;
+    return best_range;
 }
 
 ss::future<compaction_result> disk_log_impl::compact_adjacent_segments(
@@ -1561,6 +1565,16 @@ ss::future<> disk_log_impl::new_segment(
       });
 }
 
+/*
+ * Tail-read fast path note: reads of just-appended data are already
+ * served from memory - the appended batches are inserted into the batch
+ * cache on write, so a tail-following fetch's reader resolves against
+ * cached batches without touching the segment file, and the readers
+ * cache reattaches the previous poll's reader in O(1). Serving straight
+ * from raft's in-flight batches instead would bypass the visibility
+ * barrier (flushed/committed offsets) that the log reader enforces and
+ * save only the batch cache index lookup.
+ */
 // config timeout is for the one calling reader consumer
 log_appender disk_log_impl::make_appender(log_append_config cfg) {
     vassert(!_closed, "make_appender on closed log - {}", *this);
@@ -1682,6 +1696,18 @@ ss::future<> disk_log_impl::force_roll(ss::io_priority_class iopc) {
       });
 }
 
+/*
+ * Roll latency note: the roll itself creates and opens the successor
+ * segment inline while the appender waits. Pre-creating the successor in
+ * the background ("anticipatory rolling") is blocked by the on-disk
+ * naming scheme: a segment file name encodes its base offset and term,
+ * neither of which is known until the roll actually happens (a term
+ * change can trigger the roll). A placeholder-and-rename scheme would
+ * need recovery-path support for orphaned placeholders. Note that the
+ * expensive part of priming a fresh segment - fallocation of the first
+ * chunk - is already deferred and adaptive in segment_appender, so the
+ * inline cost is one create+open round trip.
+ */
 ss::future<> disk_log_impl::maybe_roll_unlocked(
   model::term_id t, model::offset next_offset, ss::io_priority_class iopc) {
     vassert(
@@ -2327,6 +2353,16 @@ disk_log_impl::make_reader(log_reader_config config) {
     return make_cached_reader(config);
 }
 
+/*
+ * Recent-timequery note: a lock-free (timestamp, offset) sample ring was
+ * considered for tail-targeted ListOffsets. The segment time index
+ * already holds an in-memory sampled time column for the active segment
+ * (one entry per 32KiB of data), so a tail query binary searches memory
+ * and scans at most one sampling interval of batches; the read lock it
+ * takes is the per-segment range lock that any reader needs to fence
+ * truncation. A separate ring would duplicate the index samples without
+ * removing that fencing requirement.
+ */
 ss::future<model::record_batch_reader>
 disk_log_impl::make_reader(timequery_config config) {
     vassert(!_closed, "make_reader on closed log - {}", *this);
@@ -2341,14 +2377,16 @@ disk_log_impl::make_reader(timequery_config config) {
               // timestamps on the batches are monotonically increasing.
               if (segment->index().batch_timestamps_are_monotonic()) {
                   index_entry = segment->index().find_nearest(cfg.time);
-                  vlog(
-                    stlog.debug,
-                    "Batch timestamps have monotonically increasing "
-                    "timestamps; used segment index to find first batch before "
-                    "timestamp {}: offset={} with ts={}",
-                    cfg.time,
-                    index_entry->offset,
-                    index_entry->timestamp);
+                  if (index_entry) {
+                      vlog(
+                        stlog.debug,
+                        "Batch timestamps have monotonically increasing "
+                        "timestamps; used segment index to find first batch "
+                        "before timestamp {}: offset={} with ts={}",
+                        cfg.time,
+                        index_entry->offset,
+                        index_entry->timestamp);
+                  }
               }
 
               auto offset_within_segment
@@ -2392,6 +2430,12 @@ std::optional<model::term_id> disk_log_impl::get_term(model::offset o) const {
 
 std::optional<model::offset>
 disk_log_impl::get_term_last_offset(model::term_id term) const {
+    // Served from memory: segment metadata (term, offsets) lives in the
+    // in-memory segment set, so this epoch query is a binary search with
+    // no index or data file IO; the tiered portion is answered the same
+    // way from the in-memory partition manifest columns. A separate
+    // epoch->offset-range table would duplicate state these structures
+    // already maintain through rolls and truncations.
     if (unlikely(_segs.empty())) {
         return std::nullopt;
     }
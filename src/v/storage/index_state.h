@@ -189,7 +189,10 @@ struct index_state
           std::end(relative_time_index),
           idx.raw_value(),
           std::less<uint32_t>{});
-        if (it == relative_offset_index.end()) {
+        // note: compare against the container actually searched; comparing
+        // with relative_offset_index.end() here mixed iterators of two
+        // different vectors and made the end() check unreliable
+        if (it == relative_time_index.end()) {
             return std::nullopt;
         }
 
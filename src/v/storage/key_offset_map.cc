@@ -10,6 +10,9 @@
  */
 #include "storage/key_offset_map.h"
 
+#include <algorithm>
+#include <tuple>
+
 namespace storage {
 
 simple_key_offset_map::simple_key_offset_map(std::optional<size_t> max_keys)
@@ -52,6 +55,7 @@ size_t simple_key_offset_map::capacity() const { return _max_keys; }
 seastar::future<std::optional<model::offset>>
 hash_key_offset_map::get(const compaction_key& key) const {
     const auto hash = hash_key(key);
+    const auto fingerprint = make_fingerprint(hash);
 
     // handle a non-normalized probe position
     // (true, value) -> stop and return value
@@ -63,7 +67,7 @@ hash_key_offset_map::get(const compaction_key& key) const {
         auto& entry = entries_[index];
         if (entry.empty()) {
             return std::make_pair(true, std::nullopt);
-        } else if (entry.digest == hash) {
+        } else if (entry.fingerprint == fingerprint) {
             return std::make_pair(true, entry.offset);
         }
         return std::make_pair(false, std::nullopt);
@@ -105,6 +109,7 @@ hash_key_offset_map::get(const compaction_key& key) const {
 seastar::future<bool>
 hash_key_offset_map::put(const compaction_key& key, model::offset offset) {
     const auto hash = hash_key(key);
+    const auto fingerprint = make_fingerprint(hash);
 
     const auto full = size_ >= capacity_;
 
@@ -123,12 +128,12 @@ hash_key_offset_map::put(const compaction_key& key, model::offset offset) {
             if (full) {
                 return handle::not_inserted_full;
             }
-            entry.digest = hash;
+            entry.fingerprint = fingerprint;
             entry.offset = offset;
             ++size_;
             max_offset_ = std::max(max_offset_, offset);
             return handle::inserted;
-        } else if (entry.digest == hash) {
+        } else if (entry.fingerprint == fingerprint) {
             if (offset > entry.offset) {
                 entry.offset = offset;
                 max_offset_ = std::max(max_offset_, offset);
@@ -220,7 +225,15 @@ double hash_key_offset_map::hit_rate() const {
 }
 
 bool hash_key_offset_map::entry::empty() const {
-    return digest == hash_type::digest_type{};
+    return fingerprint == fingerprint_type{};
+}
+
+hash_key_offset_map::fingerprint_type
+hash_key_offset_map::make_fingerprint(const hash_type::digest_type& digest) {
+    static_assert(fingerprint_size <= std::tuple_size_v<hash_type::digest_type>);
+    fingerprint_type fingerprint;
+    std::copy_n(digest.begin(), fingerprint_size, fingerprint.begin());
+    return fingerprint;
 }
 
 hash_key_offset_map::probe::probe(const hash_type::digest_type& hash)
@@ -17,6 +17,8 @@
 
 #include <absl/container/btree_map.h>
 
+#include <array>
+
 namespace storage {
 
 /**
@@ -148,13 +150,28 @@ private:
 
     /**
      * hash table entry.
+     *
+     * Entries store a fixed-size fingerprint of the key rather than the
+     * full sha256 digest: 16 bytes keeps the collision probability
+     * negligible (birthday bound of ~2^64 keys) while shrinking an entry
+     * from 40 to 24 bytes, so the same compaction memory budget indexes
+     * roughly 66% more keys and large compacted topics complete in fewer
+     * partial passes.
      */
+    static constexpr size_t fingerprint_size = 16;
+    using fingerprint_type = std::array<char, fingerprint_size>;
+
     struct entry {
-        hash_type::digest_type digest{};
+        fingerprint_type fingerprint{};
         model::offset offset;
         bool empty() const;
     };
 
+    /**
+     * truncate a key hash to the stored fingerprint.
+     */
+    static fingerprint_type make_fingerprint(const hash_type::digest_type&);
+
     /**
      * Uses successive chunks of sizeof(index_type) bytes taken from hash(key)
      * as probes into the hash table. When `next()` returns null then the caller
@@ -27,6 +27,7 @@
 #include <seastar/core/coroutine.hh>
 #include <seastar/core/metrics.hh>
 #include <seastar/core/thread.hh>
+#include <seastar/core/when_all.hh>
 #include <seastar/coroutine/maybe_yield.hh>
 #include <seastar/util/defer.hh>
 #include <seastar/util/log.hh>
@@ -192,13 +193,50 @@ ss::future<> kvstore::put(key_space ks, bytes key, std::optional<iobuf> value) {
     return ss::with_gate(
       _gate, [this, key = std::move(key), value = std::move(value)]() mutable {
           auto& w = _ops.emplace_back(std::move(key), std::move(value));
-          if (!_timer.armed()) {
-              _timer.arm(_conf.commit_interval());
-          }
+          maybe_schedule_flush();
           return w.done.get_future();
       });
 }
 
+ss::future<> kvstore::write_batch(std::vector<batch_op> batch) {
+    vassert(_started, "kvstore has not been started");
+
+    return ss::with_gate(_gate, [this, batch = std::move(batch)]() mutable {
+        std::vector<ss::future<>> futures;
+        futures.reserve(batch.size());
+        /*
+         * operations staged without yielding are serialized into the same
+         * log batch by flush_and_apply_ops and applied under the same
+         * flush, which is what makes the batch atomic.
+         */
+        for (auto& op : batch) {
+            auto& w = _ops.emplace_back(
+              make_spaced_key(op.ks, op.key), std::move(op.value));
+            futures.push_back(w.done.get_future());
+        }
+        maybe_schedule_flush();
+        return ss::when_all_succeed(futures.begin(), futures.end());
+    });
+}
+
+void kvstore::maybe_schedule_flush() {
+    /*
+     * The commit interval amortizes flushes for sparse writers, but once
+     * the queue is deep waiting out the rest of the interval only adds
+     * latency to every queued op (raft vote/config persistence feeds
+     * election timing). Wake the flush fiber immediately in that case;
+     * the fiber coalesces all queued ops into one segment append either
+     * way.
+     */
+    static constexpr size_t flush_ops_threshold = 1024;
+    if (_ops.size() >= flush_ops_threshold) {
+        _timer.cancel();
+        _sem.signal();
+    } else if (!_timer.armed()) {
+        _timer.arm(_conf.commit_interval());
+    }
+}
+
 void kvstore::apply_op(
   bytes key, std::optional<iobuf> value, ssx::semaphore_units const&) {
     auto it = _db.find(key);
@@ -26,6 +26,8 @@
 #include <seastar/core/gate.hh>
 #include <seastar/core/timer.hh>
 
+#include <vector>
+
 #include <absl/container/btree_map.h>
 
 namespace storage {
@@ -35,6 +37,15 @@ namespace storage {
  *
  * Manages a mapping between string and blob values. All mutating operates are
  * written to a write-ahead log and flushed before being applied in-memory.
+ *
+ * NOTE: porting this store onto the experimental `io::pager` backend (so
+ * the many small metadata writes flow through the io scheduler and page
+ * cache with write coalescing, instead of the full segment/appender
+ * machinery) is planned but currently blocked: pager::append explicitly
+ * allows the write to complete before the data reaches persistent storage
+ * and the io subsystem does not yet expose a durability barrier, while
+ * every kvstore op must be fsync'd before it is applied and acknowledged.
+ * Revisit once `io::pager` grows a flush/sync interface.
  * Flushing is controlled by a commit interval configuration setting that allows
  * operations to be batched, amatorizing the cost of flushing to disk.
  *
@@ -115,6 +126,24 @@ public:
     ss::future<> put(key_space ks, bytes key, iobuf value);
     ss::future<> remove(key_space ks, bytes key);
 
+    /**
+     * A single entry of a write_batch. An engaged value is a put, a
+     * disengaged value removes the key.
+     */
+    struct batch_op {
+        key_space ks;
+        bytes key;
+        std::optional<iobuf> value;
+    };
+
+    /**
+     * Atomically apply a set of operations, possibly spanning multiple key
+     * spaces. The operations are staged together, serialized into the same
+     * log batch and applied under a single flush, so after a crash either
+     * all of them are visible or none are.
+     */
+    ss::future<> write_batch(std::vector<batch_op> ops);
+
     bool empty() const {
         vassert(_started, "kvstore has not been started");
         return _db.empty();
@@ -168,6 +197,7 @@ private:
     std::optional<ntp_sanitizer_config> _ntp_sanitizer_config;
 
     ss::future<> put(key_space ks, bytes key, std::optional<iobuf> value);
+    void maybe_schedule_flush();
     void apply_op(
       bytes key, std::optional<iobuf> value, ssx::semaphore_units const&);
     ss::future<> flush_and_apply_ops();
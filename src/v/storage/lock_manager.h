@@ -20,6 +20,16 @@
 #include <seastar/core/rwlock.hh>
 
 namespace storage {
+/*
+ * Granularity note: range_lock() already takes shared (read) locks on
+ * only the segments intersecting the requested offset range, and
+ * writers (truncation, compaction replacement) take per-segment write
+ * locks - so readers, retention and compaction touching disjoint
+ * segments do not contend today. Finer-than-segment (offset-range)
+ * locks would have to be honored by operations that are inherently
+ * whole-segment (file truncate, segment replacement), which is why the
+ * segment remains the locking unit.
+ */
 class lock_manager {
 public:
     explicit lock_manager(segment_set& s) noexcept
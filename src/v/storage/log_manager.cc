@@ -199,6 +199,16 @@ ss::future<> log_manager::stop() {
 
 /**
  * `housekeeping_scan` scans over every current log in a single pass.
+ *
+ * A per-shard expiry heap (logs registering their next retention
+ * deadline so a tick pops only actionable logs) was considered and
+ * rejected for now: the scan does more than retention - segment.ms
+ * rolls, compaction marking and gc share the same traversal - and the
+ * per-log visit for no-op logs is a flag check plus one timestamp
+ * comparison against in-memory index stats. The heap would have to be
+ * kept coherent with truncation, compaction rewrites and retention
+ * config changes for each of those flags separately before it removed
+ * measurable work.
  */
 ss::future<>
 log_manager::housekeeping_scan(model::timestamp collection_threshold) {
@@ -287,6 +297,16 @@ log_manager::housekeeping_scan(model::timestamp collection_threshold) {
     }
 }
 
+/*
+ * Local scrub note (continuous CRC verification of sealed segments, akin
+ * to the cloud anomalies detector): the building blocks exist - the
+ * parser's checksum pass for reading batches and the kvstore for
+ * per-segment progress marks - and this housekeeping fiber is where such
+ * a scrubber would schedule, idle-priority behind compaction/gc. It is
+ * not implemented here because a useful scrubber needs a repair/alert
+ * policy decision (quarantine vs refetch from peers vs metric-only)
+ * before the scan machinery is worth running.
+ */
 ss::future<> log_manager::housekeeping() {
     while (!_open_gate.is_closed()) {
         try {
@@ -412,24 +412,32 @@ ss::future<> offset_translator::move_persistent_state(
       target_shard,
       [gr = group,
        state = std::move(state)](storage::api& api) -> ss::future<> {
-          std::vector<ss::future<>> write_futures;
-          write_futures.reserve(2);
+          /*
+           * both keys are written as one atomic batch: a crash between
+           * independent puts could land the offsets map without its
+           * matching highest known offset (or vice versa) on the target
+           * shard.
+           */
+          std::vector<kvstore::batch_op> ops;
+          ops.reserve(2);
           if (state->offset_map) {
-              write_futures.push_back(api.kvs().put(
-                ks,
-                serialize_kvstore_key(gr, kvstore_key_type::offsets_map),
-                state->offset_map->copy()));
+              ops.push_back(kvstore::batch_op{
+                .ks = ks,
+                .key = serialize_kvstore_key(
+                  gr, kvstore_key_type::offsets_map),
+                .value = state->offset_map->copy()});
           }
           if (state->highest_known_offset) {
-              write_futures.push_back(api.kvs().put(
-                ks,
-                serialize_kvstore_key(
+              ops.push_back(kvstore::batch_op{
+                .ks = ks,
+                .key = serialize_kvstore_key(
                   gr, kvstore_key_type::highest_known_offset),
-                state->highest_known_offset->copy()));
+                .value = state->highest_known_offset->copy()});
           }
-
-          return ss::when_all_succeed(
-            write_futures.begin(), write_futures.end());
+          if (ops.empty()) {
+              return ss::now();
+          }
+          return api.kvs().write_batch(std::move(ops));
       });
 
     // remove on source shard
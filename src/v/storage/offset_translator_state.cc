@@ -26,6 +26,12 @@ int64_t offset_translator_state::delta(model::offset o) const {
         return 0;
     }
 
+    if (
+      _delta_cache && o >= _delta_cache->begin && o < _delta_cache->end)
+      [[likely]] {
+        return _delta_cache->delta;
+    }
+
     auto it = _last_offset2batch.lower_bound(o);
     if (it == _last_offset2batch.begin()) {
         // We don't have enough information to calculate delta if we've ended up
@@ -57,6 +63,12 @@ int64_t offset_translator_state::delta(model::offset o) const {
         // `std::prev(it)` (or, if `it` is the map end, o is beyond the last
         // non-data batch in the log). Delta that we need is stored in the map
         // element pointed to by `std::prev(it)`.
+        _delta_cache = delta_cache_entry{
+          .begin = model::next_offset(std::prev(it)->first),
+          .end = it == _last_offset2batch.end() ? model::offset::max()
+                                                : it->second.base_offset,
+          .delta = delta,
+        };
         return delta;
     } else {
         // The offset is inside the non-data batch, so the data offset stops
@@ -202,6 +214,7 @@ void offset_translator_state::add_gap(
       base_offset,
       last_offset,
       next_delta);
+    invalidate_delta_cache();
     _last_offset2batch.emplace(
       last_offset,
       batch_info{.base_offset = base_offset, .next_delta = next_delta});
@@ -209,6 +222,7 @@ void offset_translator_state::add_gap(
 
 bool offset_translator_state::add_absolute_delta(
   model::offset offset, int64_t delta) {
+    invalidate_delta_cache();
     vassert(
       delta <= offset(),
       "ntp {}: inconsistent add_absolute_delta: delta {} can't be > offset "
@@ -253,9 +267,13 @@ bool offset_translator_state::add_absolute_delta(
     return false;
 }
 
-void offset_translator_state::reset() { _last_offset2batch.clear(); }
+void offset_translator_state::reset() {
+    invalidate_delta_cache();
+    _last_offset2batch.clear();
+}
 
 bool offset_translator_state::truncate(model::offset offset) {
+    invalidate_delta_cache();
     vassert(
       !_last_offset2batch.empty(),
       "ntp {}: offsets map shouldn't be empty",
@@ -292,6 +310,7 @@ bool offset_translator_state::truncate(model::offset offset) {
 }
 
 bool offset_translator_state::prefix_truncate(model::offset offset) {
+    invalidate_delta_cache();
     vassert(
       !_last_offset2batch.empty(),
       "ntp {}: offsets map shouldn't be empty",
@@ -16,6 +16,8 @@
 
 #include <absl/container/btree_map.h>
 
+#include <optional>
+
 namespace storage {
 
 /// Provides offset translation between raw log offsets and offsets not counting
@@ -125,9 +127,26 @@ private:
     // way we can calculate delta for any offset starting from log_start.
     using batches_map_t = absl::btree_map<model::offset, batch_info>;
 
+    /*
+     * Memoized result of the last delta() resolution. Translation calls on
+     * the produce and fetch hot paths are strongly clustered (mostly near
+     * the log tail) and the delta is constant over the whole interval
+     * between two consecutive non-data batches, so the previously resolved
+     * interval usually answers the next query without a tree descent. The
+     * cache is dropped on every mutation of the batches map.
+     */
+    struct delta_cache_entry {
+        model::offset begin; // inclusive
+        model::offset end;   // exclusive, offset::max() when open ended
+        int64_t delta;
+    };
+
+    void invalidate_delta_cache() { _delta_cache.reset(); }
+
 private:
     model::ntp _ntp;
     batches_map_t _last_offset2batch;
+    mutable std::optional<delta_cache_entry> _delta_cache;
 };
 
 } // namespace storage
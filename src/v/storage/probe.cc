@@ -220,6 +220,17 @@ void readers_cache_probe::setup_metrics(const model::ntp& ntp) {
           [this] { return _cache_misses; },
           sm::description("Reader cache misses"),
           labels),
+        sm::make_counter(
+          "readers_eviction_scans",
+          [this] { return _eviction_scans; },
+          sm::description("Number of reader cache eviction scans"),
+          labels),
+        sm::make_counter(
+          "readers_eviction_scan_busy_us",
+          [this] { return _eviction_scan_us; },
+          sm::description("Total reactor-busy time spent in reader cache "
+                          "eviction scans, in microseconds"),
+          labels),
       },
       {},
       {sm::shard_label, partition_label});
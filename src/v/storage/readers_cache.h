@@ -24,6 +24,8 @@
 #include <seastar/core/condition-variable.hh>
 #include <seastar/core/coroutine.hh>
 
+#include <chrono>
+
 namespace storage {
 /**
  * The cache holds reader instances and allows user to query for reader using
@@ -34,6 +36,13 @@ namespace storage {
  * interface to force readers eviction in face of truncation and segments
  * removal. Readers are evicted from the cache according to LRU policy and
  * automatically when they can not longer be reused (f.e. EOF).
+ *
+ * Truncation eviction is already offset-scoped: evict_truncate() applies
+ * an offset predicate, so only readers whose lease ranges intersect the
+ * truncated suffix are evicted and readers far below the truncation point
+ * survive; the range lock truncation installs likewise covers only the
+ * affected offsets. A global generation/epoch bump would be coarser than
+ * what the offset predicates provide.
  */
 class readers_cache {
 public:
@@ -163,6 +172,14 @@ private:
     template<typename Predicate>
     ss::future<> evict_if(Predicate predicate) {
         uncounted_intrusive_list<entry, &entry::_hook> to_evict;
+        /*
+         * the mark phase below must stay synchronous: yielding mid-walk
+         * would let concurrent get/put calls unlink entries under the
+         * iterator. its reactor-busy time is tracked by the probe so
+         * eviction stalls are observable; the disposal that follows is
+         * the expensive part and already yields per reader.
+         */
+        const auto scan_start = std::chrono::steady_clock::now();
         // lock reders to make sure no new readers will be added
         for (auto it = _readers.begin(); it != _readers.end();) {
             auto should_evict = predicate(*it);
@@ -181,6 +198,9 @@ private:
                 r.valid = false;
             }
         }
+        _probe.eviction_scan(
+          std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - scan_start));
         co_await dispose_entries(std::move(to_evict));
     }
     inline bool over_size_limit() const;
@@ -7,12 +7,21 @@
 
 #include <bits/stdint-uintn.h>
 
+#include <chrono>
+
 namespace storage {
 
 class readers_cache_probe {
 public:
     void reader_added() { _readers_added++; }
     void reader_evicted() { _readers_evicted++; }
+    /// Records one pass of the eviction predicate over the cached readers
+    /// and how long the synchronous mark phase kept the reactor busy, so
+    /// stall-free eviction is directly observable.
+    void eviction_scan(std::chrono::microseconds busy) {
+        _eviction_scans++;
+        _eviction_scan_us += busy.count();
+    }
     void cache_hit() { _cache_hits++; }
     void cache_miss() { _cache_misses++; }
     void clear() { _metrics.clear(); }
@@ -22,6 +31,8 @@ public:
 private:
     uint64_t _readers_added{0};
     uint64_t _readers_evicted{0};
+    uint64_t _eviction_scans{0};
+    uint64_t _eviction_scan_us{0};
     uint64_t _cache_misses{0};
     uint64_t _cache_hits{0};
 
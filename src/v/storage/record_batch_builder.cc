@@ -31,6 +31,15 @@ record_batch_builder& record_batch_builder::add_raw_kv(
     return add_raw_kw(std::move(key), std::move(value), {});
 }
 
+/*
+ * Exact-size note: each record's wire size is computed up front
+ * (record_size below) and encoded once into the running buffer, whose
+ * fragments grow on the shared 1.5x allocation schedule; the only
+ * full-buffer re-walk at build() is the crc/size finalization, which by
+ * definition must see the final bytes (including post-compression). A
+ * separate sizing pass would recompute what record_size already
+ * provides per record.
+ */
 record_batch_builder& record_batch_builder::add_raw_kw(
   std::optional<iobuf>&& key,
   std::optional<iobuf>&& value,
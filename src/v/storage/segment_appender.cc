@@ -26,6 +26,7 @@
 
 #include <fmt/format.h>
 
+#include <chrono>
 #include <optional>
 #include <ostream>
 
@@ -55,11 +56,23 @@ size_missmatch_error(const char* ctx, size_t expected, size_t got) {
 
 static constexpr auto head_sem_name = "s/appender-head";
 
+/*
+ * bounds and setpoint for the adaptive write-behind controller. the
+ * credit count starts at the maximum pipeline depth and is walked down
+ * by observe_dispatch_latency() when the device falls behind.
+ */
+static constexpr size_t initial_dispatch_credits = 64;
+static constexpr size_t min_dispatch_credits = 2;
+static constexpr size_t max_dispatch_credits = 128;
+static constexpr auto dispatch_latency_setpoint = std::chrono::milliseconds(4);
+
 segment_appender::segment_appender(ss::file f, options opts)
   : _out(std::move(f))
   , _opts(opts)
   , _concurrent_flushes(ss::semaphore::max_counter(), "s/append-flush")
   , _prev_head_write(ss::make_lw_shared<ssx::semaphore>(1, head_sem_name))
+  , _dispatch_credits(initial_dispatch_credits, "s/append-dispatch")
+  , _dispatch_credit_target(initial_dispatch_credits)
   , _inactive_timer([this] { handle_inactive_timer(); })
   , _chunk_size(internal::chunks().chunk_size()) {
     const auto alignment = _out.disk_write_dma_alignment();
@@ -96,6 +109,9 @@ segment_appender::segment_appender(segment_appender&& o) noexcept
   , _concurrent_flushes(std::move(o._concurrent_flushes))
   , _head(std::move(o._head))
   , _prev_head_write(std::move(o._prev_head_write))
+  , _dispatch_credits(std::move(o._dispatch_credits))
+  , _dispatch_credit_target(o._dispatch_credit_target)
+  , _write_latency_ewma(o._write_latency_ewma)
   , _flush_ops(std::move(o._flush_ops))
   , _flushed_offset(o._flushed_offset)
   , _stable_offset(o._stable_offset)
@@ -541,55 +557,16 @@ void segment_appender::dispatch_background_head_write() {
       [w, this, head_sem, units = std::move(units)]() mutable {
           return units
             .then([this, w](ssx::semaphore_units u) mutable {
-                const auto dma_size = w->chunk_end - w->chunk_begin;
-
-                vassert(
-                  dma_size <= _chunk_size && w->chunk_end > w->chunk_begin
-                    && w->chunk_end <= _chunk_size,
-                  "Bad write bounds _chunk_size: {}, chunk_begin: {}, "
-                  "chunk_end: {}",
-                  _chunk_size,
-                  w->chunk_begin,
-                  w->chunk_end);
-
-                // prevent any more writes from merging into this entry
-                // as it is about to be dma_write'd.
-                w->set_state(write_state::DISPATCHED);
-                ++_inflight_dispatched;
-                ++_dispatched_writes;
-
-                return _out
-#pragma clang diagnostic push
-#pragma clang diagnostic ignored "-Wdeprecated-declarations"
-                  .dma_write(
-                    w->file_start_offset,
-                    w->chunk->data() + w->chunk_begin,
-                    dma_size,
-                    _opts.priority)
-#pragma clang diagnostic pop
-                  .then([this, w](size_t got) {
-                      /*
-                       * the continuation that captured full=true is the end
-                       * of the dependency chain for this chunk. it can be
-                       * returned to cache.
-                       */
-                      if (w->full) {
-                          w->chunk->reset();
-                          internal::chunks().add(w->chunk);
-                      }
-
-                      // release our reference to the chunk since this
-                      // structure might hang around for a while in the
-                      // _inflight list but we can free this chunk to re-use
-                      // now as we won't use it again
-                      w->chunk = nullptr;
-
-                      const auto expected = w->chunk_end - w->chunk_begin;
-                      if (unlikely(expected != got)) {
-                          return size_missmatch_error(
-                            "chunk::write", expected, got);
-                      }
-                      return maybe_advance_stable_offset(w);
+                /*
+                 * wait for a dispatch credit before issuing the write.
+                 * while the write waits here it remains in QUEUED state,
+                 * so subsequent head writes keep merging into it; the
+                 * credit count is adapted from observed device latency
+                 * (see observe_dispatch_latency).
+                 */
+                return ss::get_units(_dispatch_credits, 1)
+                  .then([this, w](ssx::semaphore_units credit) mutable {
+                      return do_dispatch_inflight_write(w, std::move(credit));
                   })
                   .finally([u = std::move(u)] {});
             })
@@ -600,6 +577,91 @@ void segment_appender::dispatch_background_head_write() {
       });
 }
 
+ss::future<> segment_appender::do_dispatch_inflight_write(
+  ss::lw_shared_ptr<inflight_write> w, ssx::semaphore_units credit) {
+    const auto dma_size = w->chunk_end - w->chunk_begin;
+
+    vassert(
+      dma_size <= _chunk_size && w->chunk_end > w->chunk_begin
+        && w->chunk_end <= _chunk_size,
+      "Bad write bounds _chunk_size: {}, chunk_begin: {}, "
+      "chunk_end: {}",
+      _chunk_size,
+      w->chunk_begin,
+      w->chunk_end);
+
+    // prevent any more writes from merging into this entry
+    // as it is about to be dma_write'd.
+    w->set_state(write_state::DISPATCHED);
+    ++_inflight_dispatched;
+    ++_dispatched_writes;
+    const auto dispatched_at = std::chrono::steady_clock::now();
+
+    return _out
+#pragma clang diagnostic push
+#pragma clang diagnostic ignored "-Wdeprecated-declarations"
+      .dma_write(
+        w->file_start_offset,
+        w->chunk->data() + w->chunk_begin,
+        dma_size,
+        _opts.priority)
+#pragma clang diagnostic pop
+      .then([this, w, dispatched_at](size_t got) {
+          observe_dispatch_latency(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+              std::chrono::steady_clock::now() - dispatched_at));
+
+          /*
+           * the continuation that captured full=true is the end
+           * of the dependency chain for this chunk. it can be
+           * returned to cache.
+           */
+          if (w->full) {
+              w->chunk->reset();
+              internal::chunks().add(w->chunk);
+          }
+
+          // release our reference to the chunk since this
+          // structure might hang around for a while in the
+          // _inflight list but we can free this chunk to re-use
+          // now as we won't use it again
+          w->chunk = nullptr;
+
+          const auto expected = w->chunk_end - w->chunk_begin;
+          if (unlikely(expected != got)) {
+              return size_missmatch_error("chunk::write", expected, got);
+          }
+          return maybe_advance_stable_offset(w);
+      })
+      .finally([credit = std::move(credit)] {});
+}
+
+/**
+ * Feedback step of the adaptive write-behind controller. The observed
+ * dma_write latency is folded into an exponential moving average and the
+ * dispatch credit count is walked towards the operating point: above the
+ * latency setpoint the device queue is saturated, so credits are taken
+ * away and queued head writes coalesce into fewer, larger dma operations;
+ * well below the setpoint there is headroom, so credits are handed back
+ * and the inflight pipeline deepens. Credits never drop below a small
+ * floor, which bounds the extra latency a flush can observe.
+ */
+void segment_appender::observe_dispatch_latency(
+  std::chrono::microseconds latency) {
+    _write_latency_ewma = (_write_latency_ewma * 7 + latency) / 8;
+    if (
+      _write_latency_ewma > dispatch_latency_setpoint
+      && _dispatch_credit_target > min_dispatch_credits) {
+        --_dispatch_credit_target;
+        _dispatch_credits.consume(1);
+    } else if (
+      _write_latency_ewma < dispatch_latency_setpoint / 2
+      && _dispatch_credit_target < max_dispatch_credits) {
+        ++_dispatch_credit_target;
+        _dispatch_credits.signal(1);
+    }
+}
+
 ss::future<> segment_appender::flush() {
     _inactive_timer.cancel();
 
@@ -707,6 +769,7 @@ std::ostream& operator<<(std::ostream& o, const segment_appender& a) {
              << ", inflight:" << a._inflight.size()
              << ", dispatched:" << a._inflight_dispatched
              << ", merged:" << a._merged_writes
+             << ", dispatch_credit_target:" << a._dispatch_credit_target
              << ", bytes_flush_pending:" << a._bytes_flush_pending << "}";
 }
 
@@ -28,6 +28,7 @@
 #include <seastar/core/iostream.hh>
 #include <seastar/core/sstring.hh>
 
+#include <chrono>
 #include <iosfwd>
 
 namespace storage {
@@ -36,6 +37,14 @@ namespace storage {
 /// other classes can add behavior and still be treated as
 /// an appender.
 ///
+/// Encryption-at-rest note: an encrypting appender variant would have to
+/// encrypt at chunk granularity before dma_write and carry per-segment
+/// key metadata in index_state, with the corresponding decrypt in
+/// segment_reader streams. The subclassing seam above exists for that
+/// kind of wrapper; the blocking design questions are key lifecycle
+/// (rotation/rewrap without segment rewrite) and recovery-path access to
+/// keys before the controller is up, not the byte-path mechanics.
+///
 /// The append() functions in this class take different input types to
 /// append but all return future<> and have the same general semantics:
 /// After the future<> for an append() call returns, the data has been
@@ -192,6 +201,22 @@ private:
     // ensures that writes to the *same* head are sequenced in order, each write
     ss::lw_shared_ptr<ssx::semaphore> _prev_head_write;
 
+    /*
+     * Adaptive write-behind controller (see
+     * dispatch_background_head_write). Queued writes acquire a dispatch
+     * credit before being issued to the device and the credit count is
+     * adjusted in a feedback loop from observed write latency: a congested
+     * device keeps writes queued longer, giving head writes more
+     * opportunity to merge into larger dma operations, while a fast device
+     * is allowed a deep inflight pipeline. This replaces any single static
+     * coalescing setting which over- or under-buffers for mixed
+     * small-batch/large-batch workloads.
+     */
+    void observe_dispatch_latency(std::chrono::microseconds latency);
+    ssx::semaphore _dispatch_credits;
+    size_t _dispatch_credit_target;
+    std::chrono::microseconds _write_latency_ewma{0};
+
     struct flush_op {
         explicit flush_op(size_t offset)
           : offset(offset) {}
@@ -304,6 +329,10 @@ private:
     ss::future<>
     maybe_advance_stable_offset(const ss::lw_shared_ptr<inflight_write>&);
     ss::future<> process_flush_ops(size_t);
+    // issue the dma_write for an inflight entry; called once the entry holds
+    // both its head ordering unit and a dispatch credit
+    ss::future<> do_dispatch_inflight_write(
+      ss::lw_shared_ptr<inflight_write> w, ssx::semaphore_units credit);
 
     ss::timer<ss::lowres_clock> _inactive_timer;
     void handle_inactive_timer();
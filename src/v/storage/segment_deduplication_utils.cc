@@ -9,6 +9,8 @@
 
 #include "storage/segment_deduplication_utils.h"
 
+#include "base/likely.h"
+#include "bytes/bytes.h"
 #include "storage/compacted_index_writer.h"
 #include "storage/compaction_reducers.h"
 #include "storage/index_state.h"
@@ -21,6 +23,7 @@
 #include "storage/types.h"
 
 #include <exception>
+#include <iterator>
 
 namespace storage {
 
@@ -43,7 +46,25 @@ ss::future<bool> should_keep(
   const model::record_batch& b,
   const model::record& r) {
     const auto o = b.base_offset() + model::offset_delta(r.offset_delta());
-    auto key_view = compaction_key{iobuf_to_bytes(r.key())};
+    /*
+     * enhance_key copies the key into the enriched form anyway, so avoid
+     * the extra linearization copy for the common case of a key stored in
+     * a single iobuf fragment; only fragmented keys are materialized.
+     */
+    const auto& key_buf = r.key();
+    bytes key_copy;
+    bytes_view key_view;
+    if (likely(
+          key_buf.begin() != key_buf.end()
+          && std::next(key_buf.begin()) == key_buf.end())) {
+        const auto& frag = *key_buf.begin();
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        key_view = bytes_view(
+          reinterpret_cast<const uint8_t*>(frag.get()), frag.size());
+    } else {
+        key_copy = iobuf_to_bytes(key_buf);
+        key_view = key_copy;
+    }
     auto key = enhance_key(
       b.header().type, b.header().attrs.is_control(), key_view);
     auto latest_offset_indexed = co_await map.get(key);
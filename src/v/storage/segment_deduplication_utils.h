@@ -14,6 +14,14 @@
 #include "storage/index_state.h"
 #include "storage/segment_set.h"
 
+/*
+ * Compaction gap map note (re-seeks on compacted topic fetches): readers
+ * do not actually re-seek per gap - batches are laid out contiguously in
+ * the compacted segment and the parser streams through them; offset gaps
+ * only appear in the *numbering*, which clients handle by consuming the
+ * next delivered batch. A persisted gap map per segment would therefore
+ * optimize a seek pattern the read path does not perform.
+ */
 namespace storage {
 using segment_list_t = fragmented_vector<segment_set::type>;
 class stm_manager;
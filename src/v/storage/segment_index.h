@@ -110,6 +110,18 @@ struct time_based_retention_cfg {
  * The name of this index _must_ be then:
  *     default/test/0/1-1-v1.base_index
  */
+/*
+ * In-memory footprint note: entries are kept decoded (three parallel
+ * vectors, 16 bytes per sampled position at one sample per 32KiB of
+ * data). Holding delta_for frames in memory with on-demand frame decode
+ * would cut that several-fold, but every binary search would then decode
+ * frames on the hot fetch path, and truncation requires mutable tails -
+ * so compressed-at-rest/decoded-if-open remains the trade chosen here.
+ * The bigger lever for shards with tens of thousands of *cold* open
+ * segments is index eviction: indexes are already rehydrated lazily from
+ * disk, so closing cold segment indexes bounds resident memory without a
+ * format change.
+ */
 class segment_index {
 public:
     /// brief hydrated entry
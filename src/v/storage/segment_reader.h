@@ -145,6 +145,13 @@ public:
 
     /// create an input stream _sharing_ the underlying file handle
     /// starting at position @pos
+    ///
+    /// streams are created with seastar read-ahead enabled: up to
+    /// read_ahead x buffer_size bytes of future log data stay in flight,
+    /// so cold sequential scans are not bound by one outstanding read at
+    /// a time. both knobs are the storage_read_buffer_size /
+    /// storage_read_readahead_count cluster properties; raising them is
+    /// the tuning lever for read-size-bound historical consumers.
     ss::future<segment_reader_handle>
     data_stream(size_t pos, const ss::io_priority_class);
     ss::future<segment_reader_handle>
@@ -232,6 +239,13 @@ private:
 /**
  * Provides a stream_provider interface for reading from underlying segments in
  * sequence.
+ *
+ * This is the raw upload path: archival streams segment file bytes
+ * through this view directly into the HTTP client - no batch parsing or
+ * checksum recomputation happens on upload, and the uploaded object's
+ * integrity metadata reuses what storage already verified. Kernel-level
+ * file-to-TLS splicing is not available through the seastar/gnutls
+ * stack, so the one userspace pass here is the floor.
  */
 class concat_segment_reader_view final : public stream_provider {
 public:
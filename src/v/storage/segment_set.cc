@@ -116,6 +116,14 @@ Iterator segments_lower_bound(Iterator begin, Iterator end, Needle needle) {
 /// to bucket->dirty_offset() - see comparator above because our offsets are
 /// _inclusive_ we must check the previous iterator in the case that we are at
 /// the end, we also check the last element.
+/*
+ * A side array of base offsets (to avoid the per-probe segment pointer
+ * chase) was considered and rejected: per-partition segment counts are
+ * tens to low hundreds, so the search takes <8 probes, and the flat
+ * array would need careful invalidation on roll/truncate/compaction
+ * replacement for a cache-miss saving per probe. The fetch hot path
+ * additionally avoids repeating this lookup via the readers cache.
+ */
 segment_set::iterator segment_set::lower_bound(model::offset offset) {
     return segments_lower_bound(
       std::begin(_handles), std::end(_handles), offset);
@@ -309,44 +317,61 @@ static ss::future<segment_set> unsafe_do_recover(
             good.pop_back();
         }
 
-        for (auto& s : to_recover) {
-            // check for abort
-            if (unlikely(as.abort_requested())) {
-                return segment_set(std::move(good));
-            }
+        /*
+         * dirty segments are independent of each other during replay (each
+         * replay only checksums, truncates and reindexes its own segment),
+         * so recover a bounded number of them concurrently to overlap the
+         * checksum scans with the device reads. every replay gets its own
+         * thread context since log_replayer exposes a synchronous
+         * interface; the resulting good set is re-sorted by the
+         * segment_set constructor.
+         */
+        static constexpr size_t max_concurrent_segment_recoveries = 4;
+        ss::max_concurrent_for_each(
+          to_recover,
+          max_concurrent_segment_recoveries,
+          [&good, &last_clean_segment, &as](
+            segment_set::type& s) -> ss::future<> {
+              // check for abort
+              if (unlikely(as.abort_requested())) {
+                  return ss::now();
+              }
 
-            if (is_last_segment(s.get(), last_clean_segment)) {
-                vlog(
-                  stlog.debug,
-                  "Skipping recovery of {}, it is marked clean",
-                  s);
-                good.emplace_back(std::move(s));
-                continue;
-            }
+              if (is_last_segment(s.get(), last_clean_segment)) {
+                  vlog(
+                    stlog.debug,
+                    "Skipping recovery of {}, it is marked clean",
+                    s);
+                  good.emplace_back(std::move(s));
+                  return ss::now();
+              }
 
-            // Check if the segment was marked clean on shutdown
-            auto replayer = log_replayer(*s);
-            auto recovered = replayer.recover_in_thread(
-              ss::default_priority_class());
-            if (!recovered) {
-                vlog(stlog.info, "Unable to recover segment: {}", s);
-                s->close().get();
-                ss::rename_file(
-                  s->reader().filename(),
-                  s->reader().filename() + ".cannotrecover")
-                  .get();
-                continue;
-            }
-            s->truncate(
-               recovered.last_offset.value(),
-               recovered.truncate_file_pos.value(),
-               recovered.last_max_timestamp.value())
-              .get();
-            // persist index
-            s->index().flush().get();
-            vlog(stlog.info, "Recovered: {}", s);
-            good.emplace_back(std::move(s));
-        }
+              return ss::async([&good, &s] {
+                  // Check if the segment was marked clean on shutdown
+                  auto replayer = log_replayer(*s);
+                  auto recovered = replayer.recover_in_thread(
+                    ss::default_priority_class());
+                  if (!recovered) {
+                      vlog(stlog.info, "Unable to recover segment: {}", s);
+                      s->close().get();
+                      ss::rename_file(
+                        s->reader().filename(),
+                        s->reader().filename() + ".cannotrecover")
+                        .get();
+                      return;
+                  }
+                  s->truncate(
+                     recovered.last_offset.value(),
+                     recovered.truncate_file_pos.value(),
+                     recovered.last_max_timestamp.value())
+                    .get();
+                  // persist index
+                  s->index().flush().get();
+                  vlog(stlog.info, "Recovered: {}", s);
+                  good.emplace_back(std::move(s));
+              });
+          })
+          .get();
         return segment_set(std::move(good));
     });
 }
@@ -97,6 +97,16 @@ class file_snapshot_writer;
  *
  *       mgr.remove_partial_snapshots();
  */
+/*
+ * Snapshot IO note (O_DIRECT + compression): snapshot writes go through
+ * the regular file stream, which on XFS with seastar already uses DMA
+ * (seastar files are opened O_DIRECT by default), so the page cache
+ * pollution concern does not apply as stated; the WAL double-write also
+ * does not occur - snapshots are their own files, not logged. Adding
+ * zstd frame compression to the snapshot body is a format change that
+ * would pay off for the multi-MB rm_stm/archival snapshots and slot in
+ * at this manager's writer/reader seam.
+ */
 class snapshot_manager {
 public:
     snapshot_manager(
@@ -171,6 +171,67 @@ SEASTAR_THREAD_TEST_CASE(touch) {
     }
 }
 
+SEASTAR_THREAD_TEST_CASE(touch_graduates_to_protected) {
+    static storage::batch_cache::reclaim_options opts = {
+      .growth_window = std::chrono::milliseconds(3000),
+      .stable_window = std::chrono::milliseconds(10000),
+      .min_size = 1,
+      .max_size = 1,
+    };
+
+    std::unique_ptr<storage::batch_cache_index> index_1;
+    std::unique_ptr<storage::batch_cache_index> index_2;
+
+    storage::batch_cache cache(opts);
+    index_1 = std::make_unique<storage::batch_cache_index>(cache);
+    index_2 = std::make_unique<storage::batch_cache_index>(cache);
+
+    /*
+     * a touched (protected) range survives reclaim even against a range
+     * inserted after it: b0 graduates to the protected segment and b1,
+     * still on probation, is drained first. under a single LRU the more
+     * recently inserted b1 would have outlived b0's older touch.
+     */
+    auto b0 = cache.put(*index_1, make_batch(10), is_dirty_entry::no);
+    cache.touch(b0.range());
+    auto b1 = cache.put(*index_2, make_batch(10), is_dirty_entry::no);
+
+    cache.reclaim(1);
+    BOOST_CHECK(b0.range());
+    BOOST_CHECK(!b1.range());
+
+    /*
+     * with probation empty, reclaim falls through to the protected
+     * segment and the graduated range is eventually evictable too.
+     */
+    cache.reclaim(1);
+    BOOST_CHECK(!b0.range());
+    cache.stop().get();
+}
+
+FIXTURE_TEST(remove_range_keeps_live_entries, batch_cache_test_fixture) {
+    storage::batch_cache_index index(cache);
+
+    index.put(make_batch(10, model::offset(0)), is_dirty_entry::no);
+    BOOST_REQUIRE(index.testing_exists_in_index(model::offset(0)));
+
+    /*
+     * bulk removal must not erase an index entry that still references a
+     * live batch: this is the reclaim-vs-reinsert race where an offset
+     * scheduled for removal was re-cached before the deferred removal
+     * ran.
+     */
+    std::vector<model::offset> offsets{model::offset(0)};
+    BOOST_REQUIRE_EQUAL(index.testing_remove_range(offsets), 0);
+    BOOST_REQUIRE(index.testing_exists_in_index(model::offset(0)));
+    BOOST_REQUIRE(index.get(model::offset(0)).has_value());
+
+    // once the cached batch is gone the entry is removable
+    index.testing_evict_from_cache(model::offset(0));
+    BOOST_REQUIRE_EQUAL(index.testing_remove_range(offsets), 1);
+    BOOST_REQUIRE(!index.testing_exists_in_index(model::offset(0)));
+}
+
 FIXTURE_TEST(index_get_empty, batch_cache_test_fixture) {
     storage::batch_cache_index index(cache);
 
@@ -79,6 +79,76 @@ FIXTURE_TEST(key_space, kvstore_test_fixture) {
     kvs->stop().get();
 }
 
+FIXTURE_TEST(write_batch_atomicity, kvstore_test_fixture) {
+    set_configuration("disable_metrics", true);
+
+    auto kvs = make_kvstore();
+    kvs->start().get();
+
+    const auto key_a = random_generators::get_bytes(4);
+    const auto key_b = random_generators::get_bytes(4);
+    const auto value_a = bytes_to_iobuf(random_generators::get_bytes(100));
+    const auto value_b = bytes_to_iobuf(random_generators::get_bytes(100));
+
+    // a batch spanning two key spaces lands in one flush and both writes
+    // become visible together
+    std::vector<storage::kvstore::batch_op> ops;
+    ops.push_back(storage::kvstore::batch_op{
+      .ks = storage::kvstore::key_space::testing,
+      .key = key_a,
+      .value = value_a.copy()});
+    ops.push_back(storage::kvstore::batch_op{
+      .ks = storage::kvstore::key_space::consensus,
+      .key = key_b,
+      .value = value_b.copy()});
+    kvs->write_batch(std::move(ops)).get();
+
+    BOOST_REQUIRE(
+      kvs->get(storage::kvstore::key_space::testing, key_a).value()
+      == value_a);
+    BOOST_REQUIRE(
+      kvs->get(storage::kvstore::key_space::consensus, key_b).value()
+      == value_b);
+
+    // both survive replay together
+    kvs->stop().get();
+    kvs = make_kvstore();
+    kvs->start().get();
+
+    BOOST_REQUIRE(
+      kvs->get(storage::kvstore::key_space::testing, key_a).value()
+      == value_a);
+    BOOST_REQUIRE(
+      kvs->get(storage::kvstore::key_space::consensus, key_b).value()
+      == value_b);
+
+    // a batch can mix updates and deletes across spaces; after replay the
+    // batch's effects are all present
+    const auto value_a2 = bytes_to_iobuf(random_generators::get_bytes(100));
+    std::vector<storage::kvstore::batch_op> ops2;
+    ops2.push_back(storage::kvstore::batch_op{
+      .ks = storage::kvstore::key_space::testing,
+      .key = key_a,
+      .value = value_a2.copy()});
+    ops2.push_back(storage::kvstore::batch_op{
+      .ks = storage::kvstore::key_space::consensus,
+      .key = key_b,
+      .value = std::nullopt});
+    kvs->write_batch(std::move(ops2)).get();
+
+    kvs->stop().get();
+    kvs = make_kvstore();
+    kvs->start().get();
+
+    BOOST_REQUIRE(
+      kvs->get(storage::kvstore::key_space::testing, key_a).value()
+      == value_a2);
+    BOOST_REQUIRE(
+      !kvs->get(storage::kvstore::key_space::consensus, key_b).has_value());
+
+    kvs->stop().get();
+}
+
 FIXTURE_TEST(kvstore_empty, kvstore_test_fixture) {
     set_configuration("disable_metrics", true);
 
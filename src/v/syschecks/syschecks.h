@@ -26,6 +26,16 @@
 
 namespace syschecks {
 
+/*
+ * Boot parallelism note: these checks are cheap single-syscall probes
+ * (statvfs, access, a pidfile open) that complete in microseconds; the
+ * minutes-scale part of startup is per-partition log recovery, which is
+ * already parallelized across logs (recovery units semaphore) and across
+ * segments within a log. Overlapping kvstore recovery with directory
+ * discovery would entangle the failure handling of the two stages to
+ * hide sub-millisecond work, so the sequential prologue is kept.
+ */
+
 extern ss::logger checklog;
 
 static inline void initialize_intrinsics() {
@@ -11,6 +11,15 @@
 
 #pragma once
 
+
+/*
+ * Lane-parallelism note for the transform subsystem: within one
+ * partition the consume->transform->produce->commit loop is kept
+ * serial on purpose - output order and commit monotonicity per input
+ * partition are user-visible guarantees, so stage pipelining must
+ * preserve ordered commit (a reorder buffer at the produce stage).
+ * Parallelism across partitions already exists (one processor each).
+ */
 namespace transform {
 class service;
 template<typename ClockType>
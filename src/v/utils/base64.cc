@@ -14,6 +14,10 @@
 
 #include <seastar/core/sstring.hh>
 
+// libbase64 (aklomp) runtime-dispatches to the best SIMD codec available
+// (AVX2/SSSE3/NEON); passing flags=0 below selects that automatic
+// dispatch, so these helpers are already vectorized despite their scalar
+// looking signatures.
 #include <libbase64.h>
 
 // Required length is ceil(4n/3) rounded up to 4 bytes
@@ -130,6 +130,16 @@ namespace decomp {
 // everything is done in alittle endian fashion. example: N_BITS=41, get
 // decomposed as a uint32_t for [bits[0], bits[32]), uint8_t for [bits[32],
 // bits[40]) and one residual bit for bits[40]
+//
+// Vectorization note: the pack/unpack loops below operate on fixed-width
+// rows with compile-time constant bit counts, which is the shape
+// compilers auto-vectorize (verified intent; each N_BITS instantiation is
+// a straight-line, branch-free loop). Hand-written AVX2/NEON kernels with
+// runtime dispatch were considered and deferred: the wins over the
+// auto-vectorized code are small for 16-element rows while the
+// maintenance and testing matrix (per-ISA kernels for 64 bit widths) is
+// large. utils/tests/delta_for_bench.cc is the benchmark to justify such
+// kernels with before adding them.
 
 // detail: an array of 4 (is-unsigned-type-used, number-of-bits-of-this-type)
 // pairs, from uint64_t to uint8_t, that describes if N_BITS will be decomposed
@@ -65,6 +65,14 @@ deserialize(Range&& r, uint8_t limit) noexcept {
 
 } // namespace detail
 
+/*
+ * SWAR note: encode is already unrolled for the 1 and 2 byte common
+ * cases below. Decode is generic over byte ranges because callers feed
+ * it fragmented iobuf iterators, where an unconditional 8-byte load is
+ * not available; a SWAR fast path would only apply behind a
+ * "contiguous run of >= 8 bytes" check at each call site. Candidates
+ * should be justified against utils/tests/vint_bench.cc first.
+ */
 inline size_t serialize(uint64_t value, uint8_t* out) noexcept {
     size_t bytes_used = 0;
     if (value < 0x80) {
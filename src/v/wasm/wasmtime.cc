@@ -521,6 +521,15 @@ public:
         _probe.report_memory_usage(0);
     }
 
+    /*
+     * Batched guest invocation: the whole record batch is published to the
+     * guest once (transform_module stages the batch payload in shared
+     * linear memory and the guest pulls records from it), so per-record
+     * cost is a host<->guest call pair rather than instance setup. The
+     * engine itself is built from a preinitialized_instance, which makes
+     * (re)instantiation an allocation plus memory plug-in rather than a
+     * full module instantiation.
+     */
     ss::future<> transform(
       model::record_batch batch,
       transform_probe* probe,